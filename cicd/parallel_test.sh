@@ -0,0 +1,133 @@
+#! /bin/bash
+
+set -e -o pipefail
+
+. "${BASH_SOURCE[0]%/*}/utils.sh"
+
+usage() {
+  echo "Run Boost.Test cases of a test binary in parallel processes."
+  echo
+  echo "Usage:"
+  echo
+  echo "  $PROGNAME [ OPTIONS ] <test binary> [ -- <extra test binary args> ]"
+  echo
+  echo "Options:"
+  echo
+  echo "  --jobs <n>          : number of worker processes; default: number of CPUs"
+  echo "  --run-test <filter> : run test cases matching a Boost.Test filter (may be repeated),"
+  echo "                        disabled cases like the RTP ones are run only when named here;"
+  echo "                        default: all enabled test cases"
+  echo "  --report <file>     : merged JUnit report; default: <test binary>.junit.xml"
+  echo
+  echo "  -h, --help          : print this message"
+}
+
+jobs="$(getconf _NPROCESSORS_ONLN)"
+filters=()
+report=""
+
+OPTS="$( getopt -o "h" -l "\
+jobs:,\
+run-test:,\
+report:,\
+help" -n "$PROGNAME" -- "$@" )"
+eval set -- "$OPTS"
+while true; do
+  case "${1:-}" in
+  (--jobs)     jobs="$2"        ; shift 2 ;;
+  (--run-test) filters+=("$2")  ; shift 2 ;;
+  (--report)   report="$2"      ; shift 2 ;;
+  (-h|--help)  usage ; exit 0 ;;
+  (--)         shift ; break ;;
+  (*)          die "Invalid option: ${1:-}." ;;
+  esac
+done
+unset OPTS
+
+test_bin="${1:?$(usage)}"
+shift
+extra_args=("$@")
+report="${report:-$test_bin.junit.xml}"
+
+# list_tests [ <boost args> ] => full paths of test cases, one per line
+#
+# --list_content prints the test tree indented by 4 spaces per level,
+# enabled units are marked with '*'; a unit followed by a deeper one is a suite.
+list_tests() {
+  "$test_bin" --list_content "$@" 2>&1 | awk '
+    function flush(next_depth) {
+      if (name != "" && next_depth <= depth && enabled) print path
+    }
+    {
+      match($0, /^ */)
+      d = RLENGTH / 4
+      flush(d)
+      depth = d
+      name = substr($0, RLENGTH + 1)
+      enabled = sub(/\*$/, "", name)
+      stack[depth] = name
+      path = stack[0]
+      for (i = 1; i <= depth; i++) path = path "/" stack[i]
+    }
+    END { flush(0) }
+  '
+}
+
+run_args=()
+for f in "${filters[@]}"; do run_args+=(--run_test="$f"); done
+# units named by a filter are listed as enabled even if they're disabled by default
+mapfile -t tests < <(list_tests "${run_args[@]}")
+
+[[ ${#tests[@]} -gt 0 ]] || die "No test cases found in $test_bin."
+(( jobs > ${#tests[@]} )) && jobs=${#tests[@]}
+
+log "Running ${#tests[@]} test cases in $jobs processes"
+
+work_dir="$(mktemp -d)"
+trap 'rm -rf "$work_dir"' EXIT
+
+# round robin, so long test cases declared next to each other end up in different shards
+pids=()
+for (( shard = 0; shard < jobs; shard++ )); do
+  args=()
+  for (( i = shard; i < ${#tests[@]}; i += jobs )); do
+    args+=(--run_test="${tests[i]}")
+  done
+  "$test_bin" "${args[@]}" \
+      --logger=HRF,test_suite,stdout:JUNIT,all,"$work_dir/shard_$shard.xml" \
+      "${extra_args[@]}" > "$work_dir/shard_$shard.log" 2>&1 &
+  pids+=($!)
+done
+
+failed_shards=()
+for (( shard = 0; shard < jobs; shard++ )); do
+  if ! wait "${pids[shard]}"; then
+    failed_shards+=("$shard")
+  fi
+done
+
+# merge the shard reports into one <testsuites> document
+{
+  echo '<?xml version="1.0" encoding="UTF-8"?>'
+  echo '<testsuites>'
+  for (( shard = 0; shard < jobs; shard++ )); do
+    [[ -f "$work_dir/shard_$shard.xml" ]] && grep -v '^<?xml' "$work_dir/shard_$shard.xml"
+  done
+  echo '</testsuites>'
+} > "$report"
+log "JUnit report: $report"
+
+if [[ ${#failed_shards[@]} -gt 0 ]]; then
+  for shard in "${failed_shards[@]}"; do
+    err "Shard #$shard failed:"
+    cat >&2 "$work_dir/shard_$shard.log"
+  done
+  # test cases with a failure or an error in the merged report
+  failed_tests="$(awk '
+    /<testcase / { match($0, /name="[^"]*"/); name = substr($0, RSTART + 6, RLENGTH - 7) }
+    /<failure|<error/ && name != "" { print "  " name; name = "" }
+  ' "$report")"
+  die "Failed test cases:"$'\n'"${failed_tests:-  <see the logs above>}"
+fi
+
+log "All ${#tests[@]} test cases passed"
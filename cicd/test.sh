@@ -5,13 +5,24 @@ set -e -o pipefail
 
 . "${BASH_SOURCE[0]%/*}/utils.sh"
 
+# TEST_JOBS=<n> runs test cases in n parallel processes, see parallel_test.sh
+run_tests() {
+    local test_bin="$1"
+    shift
+    if [[ "${TEST_JOBS:-1}" -gt 1 ]]; then
+        ./cicd/parallel_test.sh --jobs "$TEST_JOBS" "$test_bin" -- "$@"
+    else
+        "$test_bin" "$@"
+    fi
+}
+
 log "=========== Running unit tests ==========="
 (
-    ./build/tests/blackjack_unit_test $@
+    run_tests ./build/tests/blackjack_unit_test $@
 )
 
 log "=========== Running debug unit tests ==========="
 (
     ./cicd/build.sh --debug
-    ./build-debug/tests/blackjack_unit_test $@
-)
\ No newline at end of file
+    run_tests ./build-debug/tests/blackjack_unit_test $@
+)
@@ -1,7 +1,14 @@
 #pragma once
 
+#include <eosio/singleton.hpp>
 #include <game-contract-sdk/game_base.hpp>
 #include <blackjack/card.hpp>
+#include <blackjack/draw.hpp>
+#include <blackjack/hint.hpp>
+#include <blackjack/log.hpp>
+#include <blackjack/max_win.hpp>
+#include <blackjack/message.hpp>
+#include <blackjack/state_machine.hpp>
 
 namespace blackjack {
 
@@ -10,7 +17,6 @@ using eosio::asset;
 using bytes = std::vector<char>;
 using eosio::checksum256;
 using eosio::check;
-using card_game::labels_t;
 using card_game::card;
 using card_game::cards_t;
 using card_game::combination;
@@ -23,6 +29,11 @@ namespace param {
     const uint16_t max_payout = 2;
     const uint16_t max_pair = 3;
     const uint16_t max_first_three = 4;
+    // optional, non zero deals from the casino's continuous shuffling machine: a shoe kept between
+    // the casino's sessions that gets their cards back once they're over, see shoe_row.
+    // It raises the RTP by about 0.3% and the machine's public row can be counted, see README.
+    // It's only used if the casino has also opted in with the setshuffle action, off by default
+    const uint16_t continuous_shuffle = 5;
 }
 
 namespace action {
@@ -37,41 +48,52 @@ namespace decision {
     const uint16_t double_down = 3;
 }
 
+#ifndef STATS_SHARDS
+#define STATS_SHARDS 1
+#endif
+
+// maximum number of boxes a player may play in one session against the same dealer
+const uint8_t max_boxes = 5;
+
+// side bet paytables, a losing bet returns -qty
+asset get_pair_win(const cards_t& cards, asset qty);
+asset get_first_three_win(cards_t player_cards, card third_card, asset qty);
+
 class [[eosio::contract]] blackjack: public game_sdk::game {
 
 public:
-    struct [[eosio::table("bet")]] bet_row {
-        uint64_t ses_id;
+    struct box_bet {
         asset ante;
         // side bets
         asset pair;
         asset first_three;
 
+        EOSLIB_SERIALIZE(box_bet, (ante)(pair)(first_three))
+    };
+
+    struct [[eosio::table("bet")]] bet_row {
+        uint64_t ses_id;
+        std::vector<box_bet> boxes;
+
         asset side_bets_sum() const {
-            return pair + first_three;
+            asset sum = boxes.front().pair + boxes.front().first_three;
+            for (auto it = std::next(boxes.begin()); it != boxes.end(); ++it) {
+                sum += it->pair + it->first_three;
+            }
+            return sum;
         }
 
         uint64_t primary_key() const { return ses_id; }
 
-        EOSLIB_SERIALIZE(bet_row, (ses_id)(ante)(pair)(first_three))
+        EOSLIB_SERIALIZE(bet_row, (ses_id)(boxes))
     };
 
-    enum game_state {
-        require_bet,
-        require_play,
-        deal_one_card,
-        stand,
-        double_down,
-        split,
-        deal_cards,
-    };
-
-    struct [[eosio::table("state")]] state_row {
-        uint64_t ses_id;
-        uint16_t state;
+    using game_state = fsm::game_state;
 
+    struct box_state {
         cards_t active_cards;
-        card dealer_card;
+        // ante of the active hand, doubles on double down
+        asset ante;
 
         // need this to handle split action
         cards_t split_cards;
@@ -82,9 +104,6 @@ public:
         asset pair_win;
         asset first_three_win;
 
-        // in case casino fails to send signidice
-        asset max_player_win;
-
         // methods
         bool has_hit() const {
             return active_cards.size() > 2;
@@ -92,21 +111,124 @@ public:
         bool has_split() const {
             return !split_cards.empty();
         }
+        bool has_blackjack() const {
+            return !has_split() && active_cards.size() == 2 && card_game::get_weight(active_cards) == 21;
+        }
+
+        EOSLIB_SERIALIZE(box_state,
+                        (active_cards)(ante)(split_cards)(first_round_ante)(second_round)
+                        (pair_win)(first_three_win))
+    };
+
+    struct [[eosio::table("state")]] state_row {
+        uint64_t ses_id;
+        uint16_t state;
+
+        // boxes are played one after another, the dealer plays once for all of them
+        std::vector<box_state> boxes;
+        uint8_t active_box = 0;
+        card dealer_card;
+
+        // in case casino fails to send signidice
+        asset max_player_win;
+
+        // methods
+        const box_state& active() const {
+            return boxes[active_box];
+        }
+        asset staked_sum() const {
+            asset sum = boxes.front().ante + boxes.front().first_round_ante;
+            for (auto it = std::next(boxes.begin()); it != boxes.end(); ++it) {
+                sum += it->ante + it->first_round_ante;
+            }
+            return sum;
+        }
         uint64_t primary_key() const { return ses_id; }
 
+        // key of the bystate index: the sessions in a state are a range ordered by ses_id,
+        // from state_key(s, 0) to state_key(s + 1, 0)
+        static uint128_t state_key(uint16_t state, uint64_t ses_id) {
+            return uint128_t(state) << 64 | ses_id;
+        }
+        uint128_t by_state() const { return state_key(state, ses_id); }
+
         EOSLIB_SERIALIZE(state_row,
-                        (ses_id)(state)(active_cards)(dealer_card)(split_cards)(first_round_ante)(second_round)
-                        (pair_win)(first_three_win)
+                        (ses_id)(state)(boxes)(active_box)(dealer_card)
                         (max_player_win))
     };
 
+    // aggregate counters of finished games, rows are sharded by ses_id to spread the writes
+    struct [[eosio::table("stats")]] stats_row {
+        uint64_t shard;
+        uint64_t rounds = 0;
+        uint64_t boxes = 0;
+
+        asset ante_wagered;
+        asset ante_paid;
+        asset side_bets_wagered;
+        asset side_bets_paid;
+        // the part of the win that exceeds max payout
+        asset payout_cut;
+
+        uint64_t blackjacks = 0;
+        uint64_t splits = 0;
+        uint64_t doubles = 0;
+        uint64_t busts = 0;
+        // indexed by card_game::combination
+        std::vector<uint64_t> first_three_hits;
+
+        uint64_t primary_key() const { return shard; }
+
+        EOSLIB_SERIALIZE(stats_row,
+                        (shard)(rounds)(boxes)
+                        (ante_wagered)(ante_paid)(side_bets_wagered)(side_bets_paid)(payout_cut)
+                        (blackjacks)(splits)(doubles)(busts)(first_three_hits))
+    };
+
+    // cards left in a casino's continuous shuffling machine, scoped by casino_id. Cards dealt to a session
+    // leave it and return when the session's over, so they're out of every other session's draws meanwhile
+    struct [[eosio::table("shoe")]] shoe_row {
+        // copies of every card value
+        std::vector<uint8_t> copies;
+
+        EOSLIB_SERIALIZE(shoe_row, (copies))
+    };
+
+    // sessions with continuous shuffling that deal from fresh shoes for the rest of the game: their casino
+    // hadn't opted in when they were created, or their cards went back to the casino's shoe when it was
+    // short of the cards for a draw, or in debug builds when a scripted shoe dealt them
+    struct [[eosio::table("detached")]] detached_row {
+        uint64_t ses_id;
+
+        uint64_t primary_key() const { return ses_id; }
+
+        EOSLIB_SERIALIZE(detached_row, (ses_id))
+    };
+
+    // casinos that opted in to continuous shuffling. A session follows its casino's choice at the time
+    // it's created, so opting out leaves the machine to the sessions that already deal from it
+    struct [[eosio::table("shuffleopt")]] shuffle_opt_row {
+        uint64_t casino_id;
+
+        uint64_t primary_key() const { return casino_id; }
+
+        EOSLIB_SERIALIZE(shuffle_opt_row, (casino_id))
+    };
+
     using bet_table = eosio::multi_index<"bet"_n, bet_row>;
-    using state_table = eosio::multi_index<"state"_n, state_row>;
+    // monitoring finds the sessions stalled in a state awaiting a random without a full scan
+    using state_table = eosio::multi_index<"state"_n, state_row,
+        eosio::indexed_by<"bystate"_n, eosio::const_mem_fun<state_row, uint128_t, &state_row::by_state>>>;
+    using stats_table = eosio::multi_index<"stats"_n, stats_row>;
+    using shoe_singleton = eosio::singleton<"shoe"_n, shoe_row>;
+    using detached_table = eosio::multi_index<"detached"_n, detached_row>;
+    using shuffle_opt_table = eosio::multi_index<"shuffleopt"_n, shuffle_opt_row>;
 public:
     blackjack(name receiver, name code, eosio::datastream<const char*> ds):
         game(receiver, code, ds),
         bet(_self, _self.value),
-        state(_self, _self.value) {}
+        state(_self, _self.value),
+        stats(_self, _self.value) {}
 
     void on_new_game(uint64_t ses_id) override final;
     void on_action(uint64_t ses_id, uint16_t type, std::vector<game_sdk::param_t> params) override final;
@@ -115,45 +237,65 @@ public:
 
     void check_params(uint64_t ses_id) const;
     void check_bet(uint64_t ses_id, const param_t& ante_bet, const param_t& pair, const param_t& first_three) const;
-    param_t get_and_check(uint64_t ses_id, uint16_t param, const std::string& error_msg) const;
-
-    void validate_new_state(game_state current_state, game_state new_state) {
-        switch(new_state) {
-            case game_state::require_bet:
-                check(0, "cannot update state to require_bet");
-            case game_state::require_play:
-                check(current_state == game_state::deal_one_card ||
-                      current_state == game_state::double_down ||
-                      current_state == game_state::split ||
-                      current_state == game_state::deal_cards, "cannot update state to require_play");
-                break;
-            case game_state::deal_one_card:
-            case game_state::stand:
-            case game_state::double_down:
-            case game_state::split:
-                check(current_state == game_state::require_play, "state should be require_play");
-                break;
-            case game_state::deal_cards:
-                check(current_state == game_state::require_bet, "state should be require_bet");
-                break;
-            default:
-                check(0, "unknown new_state");
-        }
-    }
+    param_t get_and_check(uint64_t ses_id, uint16_t param, const char* error_msg) const;
 
-    void update_state(state_table::const_iterator state_itr, game_state new_state) {
-        validate_new_state(game_state(state_itr->state), new_state);
+    // moves the game along the transition table
+    // the only place the state of a row changes, modify keeps the bystate index in step
+    void update_state(state_table::const_iterator state_itr, fsm::event e) {
+        const auto new_state = fsm::next(state_itr->state, e);
+        check(new_state != fsm::illegal && new_state != game_state::finished, "illegal state transition");
         state.modify(state_itr, get_self(), [&](auto& row) {
             row.state = new_state;
         });
     }
 
+    // player's actions, return true if the next step requires a random
+    using action_handler = bool (blackjack::*)(state_table::const_iterator, const std::vector<param_t>&);
+
+    bool on_bet(state_table::const_iterator state_itr, const std::vector<param_t>& params);
+    bool on_hit(state_table::const_iterator state_itr, const std::vector<param_t>& params);
+    bool on_stand(state_table::const_iterator state_itr, const std::vector<param_t>& params);
+    bool on_split(state_table::const_iterator state_itr, const std::vector<param_t>& params);
+    bool on_double_down(state_table::const_iterator state_itr, const std::vector<param_t>& params);
+
+    // randoms, indexed by the state that awaits them
+    using random_handler = void (blackjack::*)(state_table::const_iterator, bet_table::const_iterator, const checksum256&);
+
+    void on_deal_cards_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand);
+    void on_hit_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand);
+    void on_stand_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand);
+    void on_double_down_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand);
+    void on_split_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand);
+
     using game_sdk::game::update_max_win;
 
-    void update_max_win(uint64_t ses_id, asset delta_win) {
+    // exact max player's win reachable from the current state
+    asset get_max_win(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr) const {
+        int64_t max_win = 0;
+        for (size_t i = 0; i < state_itr->boxes.size(); i++) {
+            const auto& box = state_itr->boxes[i];
+            const auto& box_bet = bet_itr->boxes[i];
+            if (box.active_cards.empty()) {
+                max_win += reserve::undealt_box(box_bet.ante.amount, box_bet.pair.amount, box_bet.first_three.amount);
+                continue;
+            }
+            max_win += reserve::box({
+                box.active_cards, box.ante.amount,
+                box.split_cards, box.first_round_ante.amount,
+                box.second_round,
+                box_bet.ante.amount,
+                (box.pair_win + box.first_three_win).amount,
+                i > state_itr->active_box || (i == state_itr->active_box && state_itr->state == game_state::require_play)
+            });
+        }
+        return asset(max_win, core_symbol);
+    }
+
+    void update_max_win(uint64_t ses_id) {
         const auto state_itr = state.require_find(ses_id, "no ses_id");
+        const auto bet_itr = bet.require_find(ses_id, "no ses_id");
         state.modify(state_itr, get_self(), [&](auto& row) {
-            row.max_player_win += delta_win;
+            row.max_player_win = get_max_win(state_itr, bet_itr);
         });
         const auto max_win = asset(*get_param_value(ses_id, param::max_payout), core_symbol);
         update_max_win(get_session(ses_id).deposit +
@@ -167,118 +309,356 @@ public:
         carry_on
     };
 
-    std::tuple<outcome, cards_t, cards_t> deal_initial_cards(state_table::const_iterator itr, const checksum256& rand);
+    // the cards an action draws, see prepare_deck
+    class deck_t;
+
+    std::tuple<cards_t, cards_t> deal_initial_cards(state_table::const_iterator itr, const checksum256& rand);
 
-    std::tuple<outcome, card, labels_t> deal_a_card(state_table::const_iterator itr, const checksum256& rand);
+    std::tuple<outcome, card, deck_t> deal_a_card(state_table::const_iterator itr, const checksum256& rand);
 
-    std::tuple<asset, cards_t> compare_and_finish(state_table::const_iterator state_itr, asset ante, const checksum256& rand, labels_t&& deck);
+    std::tuple<asset, cards_t> compare_and_finish(state_table::const_iterator state_itr, const checksum256& rand, deck_t&& deck);
 
-    cards_t open_dealer_cards(state_table::const_iterator state_itr, const checksum256& rand, labels_t& deck);
+    cards_t open_dealer_cards(state_table::const_iterator state_itr, const checksum256& rand, deck_t& deck);
 
     asset get_win(asset ante, outcome result, bool has_blackjack);
 
     std::tuple<outcome, bool> compare_cards(const cards_t& active_cards, const cards_t& dealer_cards, bool has_split);
 
-    std::vector<param_t> encode_cards(cards_t&& dealer_cards, cards_t&& player_cards = {}) {
-        std::vector<param_t> result;
-        result.reserve(2 + player_cards.size() + dealer_cards.size());
-        result.push_back(player_cards.size());
-        for (const auto& c : player_cards) {
-            result.push_back(c.get_value());
-        }
-        result.push_back(dealer_cards.size());
-        for (const auto& c : dealer_cards) {
-            result.push_back(c.get_value());
-        }
-        return result;
+    std::vector<param_t> encode_cards(const cards_t& dealer_cards, const cards_t& player_cards = {}) {
+        return message::encode(player_cards, dealer_cards);
     }
 
     void end_game(uint64_t ses_id, asset win, cards_t&& dealer_cards, cards_t&& player_cards) {
         // TODO rename param::max_payout to max_win
         const auto max_win = asset(*get_param_value(ses_id, param::max_payout), core_symbol);
         const auto payout = get_session(ses_id).deposit + std::min(win, max_win);
-        finish_game(payout, encode_cards(std::move(dealer_cards), std::move(player_cards)));
+        update_stats(ses_id, win, std::max(win - max_win, zero_asset));
+        finish_game(payout, encode_cards(dealer_cards, player_cards));
+    }
+
+    void update_stats(uint64_t ses_id, asset win, asset payout_cut);
+
+    // copies of every card value left in the shoe
+    using shoe_t = std::array<uint8_t, 52>;
+
+    // a fresh shoe without the session's cards, debug builds can script more copies of a card than it has
+    static void remove_cards(shoe_t& shoe, const cards_t& cards) {
+        for (const auto& c : cards) {
+            if (shoe[c.get_value()]) {
+                shoe[c.get_value()]--;
+            }
+        }
     }
 
-    void clean_labels(card_game::labels_t& labels, state_table::const_iterator state_itr) {
+    static void remove_cards(shoe_t& shoe, state_table::const_iterator state_itr) {
         // remove cards from the deck that are in the game
-        for (const auto& c : state_itr->active_cards) {
-            const auto it = std::find(labels.begin(), labels.end(), c.to_string());
-            if (it != labels.end()) {
-                labels.erase(it);
+        for (const auto& box : state_itr->boxes) {
+            remove_cards(shoe, box.active_cards);
+            remove_cards(shoe, box.split_cards);
+        }
+        if (state_itr->dealer_card) {
+            remove_cards(shoe, {state_itr->dealer_card});
+        }
+    }
+
+    static size_t cards_in_play(const state_row& row) {
+        size_t count = row.dealer_card ? 1 : 0;
+        for (const auto& box : row.boxes) {
+            count += box.active_cards.size() + box.split_cards.size();
+        }
+        return count;
+    }
+
+    static int cards_left(const shoe_t& shoe) {
+        int left = 0;
+        for (const auto copies : shoe) {
+            left += copies;
+        }
+        return left;
+    }
+
+    bool continuous_shuffle(uint64_t ses_id) const {
+        const auto mode = get_param_value(ses_id, param::continuous_shuffle);
+        return mode && *mode;
+    }
+
+    bool casino_shuffles(uint64_t casino_id) const {
+        shuffle_opt_table opted_in(_self, _self.value);
+        return opted_in.find(casino_id) != opted_in.end();
+    }
+
+    // the session's cards are held out of the casino's shoe
+    bool deals_from_casino_shoe(uint64_t ses_id) const {
+        if (!continuous_shuffle(ses_id)) {
+            return false;
+        }
+        detached_table detached(_self, _self.value);
+        return detached.find(ses_id) == detached.end();
+    }
+
+    // the casino's machine starts with a full shoe
+    shoe_t get_casino_shoe(uint64_t casino_id) const {
+        shoe_t shoe;
+        shoe.fill(8);
+        shoe_singleton shoes(_self, casino_id);
+        if (shoes.exists()) {
+            const auto row = shoes.get();
+            std::copy(row.copies.begin(), row.copies.end(), shoe.begin());
+        }
+        return shoe;
+    }
+
+    void set_casino_shoe(uint64_t casino_id, const shoe_t& shoe) {
+        shoe_singleton shoes(_self, casino_id);
+        shoes.set(shoe_row{std::vector<uint8_t>(shoe.begin(), shoe.end())}, _self);
+    }
+
+    // cards dealt to a session with continuous shuffling leave the casino's shoe. They were drawn from it,
+    // so a card it doesn't have is a broken shoe rather than something to skip
+    void take_from_casino_shoe(uint64_t ses_id, const cards_t& cards) {
+        if (!deals_from_casino_shoe(ses_id)) {
+            return;
+        }
+        const auto casino_id = get_session(ses_id).casino_id;
+        auto shoe = get_casino_shoe(casino_id);
+        for (const auto& c : cards) {
+            check(shoe[c.get_value()] > 0, "card isn't in the casino's shoe");
+            shoe[c.get_value()]--;
+        }
+        set_casino_shoe(casino_id, shoe);
+    }
+
+    void put_back_to_casino_shoe(const state_row& row) {
+        const auto casino_id = get_session(row.ses_id).casino_id;
+        auto shoe = get_casino_shoe(casino_id);
+        const auto put_back = [&](const cards_t& cards) {
+            for (const auto& c : cards) {
+                check(shoe[c.get_value()] < 8, "casino's shoe already has every copy of the card");
+                shoe[c.get_value()]++;
             }
+        };
+        for (const auto& box : row.boxes) {
+            put_back(box.active_cards);
+            put_back(box.split_cards);
         }
-        for (const auto& c : state_itr->split_cards) {
-            const auto it = std::find(labels.begin(), labels.end(), c.to_string());
-            if (it != labels.end()) {
-                labels.erase(it);
+        if (row.dealer_card) {
+            put_back({row.dealer_card});
+        }
+        set_casino_shoe(casino_id, shoe);
+    }
+
+    // the session's cards go back to the machine once it's over
+    void return_to_casino_shoe(const state_row& row) {
+        if (!continuous_shuffle(row.ses_id)) {
+            return;
+        }
+        detached_table detached(_self, _self.value);
+        const auto detached_itr = detached.find(row.ses_id);
+        if (detached_itr != detached.end()) {
+            detached.erase(detached_itr);
+        } else if (cards_in_play(row)) {
+            put_back_to_casino_shoe(row);
+        }
+    }
+
+    // the session's cards go back to the machine now and it deals from fresh shoes until it's over
+    void detach_from_casino_shoe(state_table::const_iterator state_itr) {
+        if (cards_in_play(*state_itr)) {
+            put_back_to_casino_shoe(*state_itr);
+        }
+        detached_table detached(_self, _self.value);
+        detached.emplace(_self, [&](auto& row) {
+            row.ses_id = state_itr->ses_id;
+        });
+    }
+
+    // the PRNG is only made once the random's own bits are used up
+    struct prng_refill {
+        const blackjack* contract;
+        checksum256 seed;
+        game_sdk::prng::ptr prng;
+
+        uint64_t operator()() {
+            if (!prng) {
+                prng = contract->get_prng(std::move(seed));
             }
+            return prng->next();
         }
-        if (state_itr->dealer_card) {
-            const auto it = std::find(labels.begin(), labels.end(), state_itr->dealer_card.to_string());
-            if (it != labels.end()) {
-                labels.erase(it);
+    };
+
+    // 8 deck blackjack. Cards are drawn one by one as the action needs them, the draws are the same
+    // as from a vector of all the cards sorted by value: a card is found by its index among the ones left
+    // instead of erasing it from the vector
+    class deck_t {
+    public:
+        deck_t(const shoe_t& shoe, index_draw<prng_refill>&& draw): shoe(shoe), left(cards_left(shoe)), draw(std::move(draw)) {}
+
+        card take() {
+        #ifdef IS_DEBUG
+            if (next_scripted < scripted.size()) {
+                return scripted[next_scripted++];
             }
+        #endif
+            check(left > 0, "empty deck");
+            return card(take_card(shoe, draw(left--)));
         }
+
+    #ifdef IS_DEBUG
+        // scripted cards are dealt before the random ones
+        void script(cards_t&& cards) {
+            scripted = std::move(cards);
+        }
+    #endif
+
+    private:
+        shoe_t shoe;
+        int left;
+        index_draw<prng_refill> draw;
+    #ifdef IS_DEBUG
+        cards_t scripted;
+        size_t next_scripted = 0;
+    #endif
+    };
+
+    // the cards a casino's machine has to have to deal a random from its shoe:
+    // 9 cards plus 2 cards for every additional box
+    static int cards_reserved(size_t boxes) {
+        return 9 + 2 * (int(boxes) - 1);
     }
 
-    card_game::labels_t prepare_deck(state_table::const_iterator state_itr, checksum256 rand) {
+    deck_t prepare_deck(state_table::const_iterator state_itr, checksum256 rand) {
+        bool from_casino_shoe = deals_from_casino_shoe(state_itr->ses_id);
     #ifdef IS_DEBUG
-        auto debug_labels = debug_labels_singleton(_self, _self.value).get_or_default().labels;
-        clean_labels(debug_labels, state_itr);
-        if (!debug_labels.empty()) {
-            return debug_labels;
+        // scripted cards are dealt in order, the ones dealt since the push are skipped,
+        // random cards follow once the script is over
+        cards_t scripted;
+        debug_shoe_table shoes(_self, _self.value);
+        const auto shoe_itr = shoes.find(state_itr->ses_id);
+        if (shoe_itr != shoes.end()) {
+            for (auto i = cards_in_play(*state_itr) - shoe_itr->in_play; i < shoe_itr->cards.size(); i++) {
+                scripted.push_back(card(shoe_itr->cards[i]));
+            }
+        }
+        if (from_casino_shoe && !scripted.empty()) {
+            // scripted cards needn't be in the casino's shoe
+            detach_from_casino_shoe(state_itr);
+            from_casino_shoe = false;
         }
     #endif
-        auto labels = card_game::get_labels();
-        // 8 deck blackjack
-        card_game::labels_t multideck;
-        multideck.reserve(8 * labels.size());
-        for (const auto& label : labels) {
-            for (int i = 0; i < 8; i++) {
-                multideck.push_back(label);
+        shoe_t shoe;
+        if (from_casino_shoe) {
+            // the session's cards have already left the casino's shoe
+            shoe = get_casino_shoe(get_session(state_itr->ses_id).casino_id);
+            if (cards_left(shoe) < cards_reserved(state_itr->boxes.size())) {
+                // too many of the casino's sessions are open for its machine to have the cards of a random
+                detach_from_casino_shoe(state_itr);
+                from_casino_shoe = false;
             }
         }
-        // remove player's cards
-        clean_labels(multideck, state_itr);
-        // draw 9 cards
-        card_game::labels_t result(9);
-        auto prng = get_prng(std::move(rand));
-        for (int i = 0; i < 9; i++) {
-            const auto idx = prng->next() % multideck.size();
-            result[i] = multideck[idx];
-            multideck.erase(multideck.begin() + idx);
-        }
-        return result;
+        if (!from_casino_shoe) {
+            // a fresh shoe without player's cards
+            shoe.fill(8);
+            remove_cards(shoe, state_itr);
+        }
+        const auto random = rand.extract_as_byte_array();
+        deck_t deck(shoe, index_draw(random, prng_refill{this, std::move(rand), nullptr}));
+    #ifdef IS_DEBUG
+        deck.script(std::move(scripted));
+    #endif
+        return deck;
     }
 
     void finish_first_round(state_table::const_iterator state_itr) {
-        eosio::print("first round's finished\n");
+        LOG_DEBUG("first round's finished\n");
         state.modify(state_itr, get_self(), [&](auto& row) {
-            row.second_round = true;
+            auto& box = row.boxes[row.active_box];
+            box.second_round = true;
             // now the split cards become active
-            std::swap(row.active_cards, row.split_cards);
+            std::swap(box.active_cards, box.split_cards);
+            std::swap(box.ante, box.first_round_ante);
         });
     }
 
-    void check_deposit(asset deposit, asset current_ante, asset prev_round_ante, asset side_bets_sum);
+    // moves to the next box without a blackjack, returns false if all boxes are played
+    bool next_box(state_table::const_iterator state_itr) {
+        size_t next = state_itr->active_box + 1;
+        while (next < state_itr->boxes.size() && state_itr->boxes[next].has_blackjack()) {
+            next++;
+        }
+        if (next == state_itr->boxes.size()) {
+            return false;
+        }
+        LOG_DEBUG("box #% is finished\n", state_itr->active_box);
+        state.modify(state_itr, get_self(), [&](auto& row) {
+            row.active_box = next;
+        });
+        return true;
+    }
+
+    // moves to the split hand of the active box or to the next box, returns false if it's dealer's turn
+    bool next_hand(state_table::const_iterator state_itr) {
+        const auto& box = state_itr->active();
+        if (box.has_split() && !box.second_round) {
+            finish_first_round(state_itr);
+            return true;
+        }
+        return next_box(state_itr);
+    }
+
+    void check_deposit(asset deposit, asset staked_sum, asset side_bets_sum);
+
+    // read-only hint for frontends: prints EVs of hit, stand, split and double down for the active hand
+    // in 1/10000 of the stake, null if the decision isn't allowed
+    [[eosio::action("evhint")]]
+    void evhint(uint64_t ses_id);
+
+    // opts a casino in to or out of continuous shuffling for its new sessions, see param::continuous_shuffle
+    [[eosio::action("setshuffle")]]
+    void setshuffle(uint64_t casino_id, bool enabled);
 
 #ifdef IS_DEBUG
-    struct [[eosio::table("labelsdeb")]] labels_deb {
-        card_game::labels_t labels;
+    // scripted shoe of a session, card ids are dealt in order
+    struct [[eosio::table("shoedeb")]] shoe_deb {
+        uint64_t ses_id;
+        std::vector<uint8_t> cards;
+        // number of cards in play when the shoe was pushed
+        uint32_t in_play;
+
+        uint64_t primary_key() const { return ses_id; }
+
+        EOSLIB_SERIALIZE(shoe_deb, (ses_id)(cards)(in_play))
     };
 
-    using debug_labels_singleton = eosio::singleton<"labelsdeb"_n, labels_deb>;
+    using debug_shoe_table = eosio::multi_index<"shoedeb"_n, shoe_deb>;
 
-    [[eosio::action("pushlabels")]]
-    void pushlabels(uint64_t ses_id, card_game::labels_t labels) {
-        debug_labels_singleton(_self, _self.value).set(labels_deb{labels}, _self);
+    [[eosio::action("pushshoe")]]
+    void pushshoe(uint64_t ses_id, std::vector<uint8_t> cards) {
+        for (const auto c : cards) {
+            check(c < 52, "invalid card id");
+        }
+        debug_shoe_table shoes(_self, _self.value);
+        const auto state_itr = state.find(ses_id);
+        const uint32_t in_play = state_itr != state.end() ? cards_in_play(*state_itr) : 0;
+        const auto shoe_itr = shoes.find(ses_id);
+        if (shoe_itr == shoes.end()) {
+            shoes.emplace(_self, [&](auto& row) {
+                row.ses_id = ses_id;
+                row.cards = std::move(cards);
+                row.in_play = in_play;
+            });
+        } else {
+            shoes.modify(shoe_itr, _self, [&](auto& row) {
+                row.cards = std::move(cards);
+                row.in_play = in_play;
+            });
+        }
     }
 #endif
 
 private:
     bet_table bet;
     state_table state;
+    stats_table stats;
 };
 
 } // ns blackjack
@@ -1,35 +1,37 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <string>
-#include <memory>
-#include <ostream>
 
 #ifndef TEST
 #include <eosio/serialize.hpp>
 #else
+#include <ostream>
 #include <fc/reflect/reflect.hpp>
 #endif
 
 namespace card_game {
 
-using labels_t = std::vector<std::string>;
-
-const std::vector<char> RANKS{'2', '3', '4', '5', '6', '7', '8', '9', 'T', 'J', 'Q', 'K', 'A'};
-const std::vector<char> COLORS{'c', 'd', 'h', 's'};
+// plain constant arrays, so the contract doesn't get any dynamic static initialization
+constexpr char RANKS[] = "23456789TJQKA";
+constexpr char COLORS[] = "cdhs";
+constexpr int RANKS_COUNT = sizeof(RANKS) - 1;
+constexpr int COLORS_COUNT = sizeof(COLORS) - 1;
 
-static labels_t get_labels() {
-    std::vector<std::string> card_labels;
-    card_labels.reserve(52);
-    for (const auto& rank : RANKS) {
-        for (const auto& color : COLORS) {
-            std::string label;
-            label.push_back(rank);
-            label.push_back(color);
-            card_labels.push_back(label);
-        }
+// returns 52 for an invalid label
+constexpr unsigned parse_label(char r, char c) {
+    int rank = 0, color = 0;
+    while (rank < RANKS_COUNT && RANKS[rank] != r) {
+        rank++;
+    }
+    while (color < COLORS_COUNT && COLORS[color] != c) {
+        color++;
+    }
+    if (rank == RANKS_COUNT || color == COLORS_COUNT) {
+        return 52;
     }
-    return card_labels;
+    return rank * COLORS_COUNT + color;
 }
 
 enum class rank;
@@ -40,20 +42,20 @@ struct card {
     card(): value(UNINITIALIZED) {}
     explicit card(int v): value(v) {}
     explicit card(const std::string& card) {
-        static const auto& labels = get_labels();
-        value = std::find(labels.begin(), labels.end(), card) - labels.begin();
+        value = card.size() == 2 ? parse_label(card[0], card[1]) : 52;
         #ifndef TEST
-        eosio::check(value < 52, "invalid card: " + card);
+        // the message is only built for an invalid label
+        if (value >= 52) {
+            eosio::check(0, "invalid card: " + card);
+        }
         #endif
     }
     card(const char s[3]) {
-        static const auto& labels = get_labels();
-        std::string card;
-        card.push_back(s[0]);
-        card.push_back(s[1]);
-        value = std::find(labels.begin(), labels.end(), card) - labels.begin();
+        value = parse_label(s[0], s[1]);
         #ifndef TEST
-        eosio::check(value < 52, "invalid card: " + std::string(s));
+        if (value >= 52) {
+            eosio::check(0, "invalid card: " + std::string(s));
+        }
         #endif
     }
 
@@ -80,9 +82,12 @@ struct card {
     rank next_rank() const { return rank(value / 4 + 1); }
 
     std::string to_string() const {
+        if (!*this) {
+            return "??";
+        }
         std::string r;
-        r.push_back(RANKS.at(static_cast<int>(get_rank())));
-        r.push_back(COLORS.at(static_cast<int>(get_color())));
+        r.push_back(RANKS[static_cast<int>(get_rank())]);
+        r.push_back(COLORS[static_cast<int>(get_color())]);
         return r;
     }
 
@@ -151,7 +156,7 @@ static int get_weight(const cards_t& cards) {
     return w;
 }
 
-bool is_hard(const cards_t& cards) {
+inline bool is_hard(const cards_t& cards) {
     int aces = 0, w = 0;
     for (const auto& c : cards) {
         if (c.get_rank() == card_game::rank::ACE) {
@@ -163,6 +168,8 @@ bool is_hard(const cards_t& cards) {
     return !aces || w + 10 > 21;
 }
 
+#ifdef TEST
+// stream helpers are used by tests only
 static std::ostream& operator<<(std::ostream& os, const card& c) {
     os << c.to_string();
     return os;
@@ -179,6 +186,7 @@ static std::ostream& operator<<(std::ostream& os, const cards_t& cards) {
     os << "}";
     return os;
 }
+#endif
 
 enum class combination : uint8_t {
     HIGH_CARD = 0,
@@ -190,7 +198,7 @@ enum class combination : uint8_t {
     SUITED_THREE_OF_A_KIND
 };
 
-combination get_combination(const cards_t& cards_) {
+inline combination get_combination(const cards_t& cards_) {
     auto cards = cards_;
     std::sort(std::begin(cards), std::end(cards), [](const card& c1, const card& c2) {
         return c1.get_rank() > c2.get_rank();
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Unbiased draws from a 256-bit random. Every draw takes a 32-bit word, so the random itself gives
+// 8 of them and the PRNG is only advanced when they run out, a 64-bit output gives 2 more words.
+// A word x maps to an index in [0, n) by multiply-shift, (x * n) >> 32: it's unbiased once the words
+// whose low half of x * n is under 2^32 mod n are rejected, which is about n / 2^32 of them.
+namespace blackjack {
+
+template <typename Refill>
+class index_draw {
+public:
+    // refill() returns the next 64 random bits, it's called only when the random's words are used up
+    index_draw(const std::array<uint8_t, 32>& random, Refill refill): refill(refill) {
+        for (int i = 0; i < 8; i++) {
+            words[i] = uint32_t(random[4 * i]) << 24 | uint32_t(random[4 * i + 1]) << 16
+                | uint32_t(random[4 * i + 2]) << 8 | random[4 * i + 3];
+        }
+    }
+
+    // uniform in [0, n), n > 0
+    uint32_t operator()(uint32_t n) {
+        while (true) {
+            const uint64_t m = uint64_t(next_word()) * n;
+            const uint32_t low = uint32_t(m);
+            // -n % n is 2^32 mod n, it's only computed for the rare words that might be rejected
+            if (low >= n || low >= uint32_t(-n) % n) {
+                return uint32_t(m >> 32);
+            }
+        }
+    }
+
+    // how many times the PRNG's been advanced
+    int refills() const {
+        return refill_count;
+    }
+
+private:
+    Refill refill;
+    std::array<uint32_t, 8> words;
+    int used = 0;
+    int refill_count = 0;
+
+    uint32_t next_word() {
+        if (used == int(words.size())) {
+            // the last two slots hold a PRNG output
+            const uint64_t r = refill();
+            words[6] = uint32_t(r >> 32);
+            words[7] = uint32_t(r);
+            used = 6;
+            refill_count++;
+        }
+        return words[used++];
+    }
+};
+
+// removes the card picked by its index among the cards left from a shoe of the copies of every card value,
+// returns its value. It's the draw from a vector of all the cards left sorted by value, without the vector
+template <typename Shoe>
+uint8_t take_card(Shoe& shoe, uint32_t idx) {
+    uint8_t value = 0;
+    while (idx >= shoe[value]) {
+        idx -= shoe[value++];
+    }
+    shoe[value]--;
+    return value;
+}
+
+} // ns blackjack
@@ -0,0 +1,55 @@
+// Generated by tools/strategy/strategy_gen, do not edit.
+#pragma once
+
+#include <cstdint>
+
+namespace blackjack { namespace hint {
+
+const int hard_classes = 18;
+const int soft_classes = 10;
+const int classes_count = 38;
+
+// EVs in 1/10000 of the stake by hand class (hard 4-21, soft 12-21, pairs A-T), up card weight - 1
+// and decision (hit, stand, split, double down), INT16_MIN if the decision isn't allowed
+const int16_t evs[classes_count][10][4] = {
+    {{-4839,-7691,INT16_MIN,INT16_MIN},{-1150,-2929,INT16_MIN,INT16_MIN},{-823,-2518,INT16_MIN,INT16_MIN},{-479,-2091,INT16_MIN,INT16_MIN},{-99,-1642,INT16_MIN,INT16_MIN},{103,-1542,INT16_MIN,INT16_MIN},{-900,-4759,INT16_MIN,INT16_MIN},{-1589,-5121,INT16_MIN,INT16_MIN},{-2397,-5419,INT16_MIN,INT16_MIN},{-3421,-5752,INT16_MIN,INT16_MIN}},
+    {{-5014,-7691,INT16_MIN,INT16_MIN},{-1284,-2929,INT16_MIN,INT16_MIN},{-953,-2518,INT16_MIN,INT16_MIN},{-603,-2091,INT16_MIN,INT16_MIN},{-217,-1642,INT16_MIN,INT16_MIN},{-20,-1542,INT16_MIN,INT16_MIN},{-1189,-4759,INT16_MIN,INT16_MIN},{-1876,-5121,INT16_MIN,INT16_MIN},{-2657,-5419,INT16_MIN,INT16_MIN},{-3645,-5752,INT16_MIN,INT16_MIN}},
+    {{-5192,-7691,INT16_MIN,INT16_MIN},{-1412,-2929,INT16_MIN,INT16_MIN},{-1075,-2518,INT16_MIN,INT16_MIN},{-719,-2091,INT16_MIN,INT16_MIN},{-326,-1642,INT16_MIN,INT16_MIN},{-127,-1542,INT16_MIN,INT16_MIN},{-1513,-4759,INT16_MIN,INT16_MIN},{-2167,-5121,INT16_MIN,INT16_MIN},{-2917,-5419,INT16_MIN,INT16_MIN},{-3870,-5752,INT16_MIN,INT16_MIN}},
+    {{-5233,-7691,INT16_MIN,INT16_MIN},{-1098,-2929,INT16_MIN,INT16_MIN},{-770,-2518,INT16_MIN,INT16_MIN},{-420,-2091,INT16_MIN,INT16_MIN},{-40,-1642,INT16_MIN,INT16_MIN},{295,-1542,INT16_MIN,INT16_MIN},{-683,-4759,INT16_MIN,INT16_MIN},{-2107,-5121,INT16_MIN,INT16_MIN},{-2842,-5419,INT16_MIN,INT16_MIN},{-3701,-5752,INT16_MIN,INT16_MIN}},
+    {{-4455,-7691,INT16_MIN,INT16_MIN},{-226,-2929,INT16_MIN,INT16_MIN},{75,-2518,INT16_MIN,INT16_MIN},{407,-2091,INT16_MIN,INT16_MIN},{742,-1642,INT16_MIN,INT16_MIN},{1155,-1542,INT16_MIN,INT16_MIN},{832,-4759,INT16_MIN,INT16_MIN},{-594,-5121,INT16_MIN,INT16_MIN},{-2097,-5419,INT16_MIN,INT16_MIN},{-3060,-5752,INT16_MIN,INT16_MIN}},
+    {{-3550,-7691,INT16_MIN,-9187},{737,-2929,INT16_MIN,617},{1020,-2518,INT16_MIN,1221},{1306,-2091,INT16_MIN,1850},{1615,-1642,INT16_MIN,2498},{1967,-1542,INT16_MIN,3180},{1732,-4759,INT16_MIN,1067},{992,-5121,INT16_MIN,-264},{-521,-5419,INT16_MIN,-3005},{-2171,-5752,INT16_MIN,-5837}},
+    {{-2534,-7691,INT16_MIN,-6291},{1831,-2929,INT16_MIN,3604},{2070,-2518,INT16_MIN,4112},{2321,-2091,INT16_MIN,4643},{2595,-1642,INT16_MIN,5190},{2886,-1542,INT16_MIN,5773},{2577,-4759,INT16_MIN,3938},{1979,-5121,INT16_MIN,2853},{1162,-5419,INT16_MIN,1440},{-535,-5752,INT16_MIN,-1628}},
+    {{-2086,-7691,INT16_MIN,-5385},{2393,-2929,INT16_MIN,4725},{2615,-2518,INT16_MIN,5202},{2849,-2091,INT16_MIN,5698},{3104,-1642,INT16_MIN,6208},{3342,-1542,INT16_MIN,6685},{2918,-4759,INT16_MIN,4620},{2288,-5121,INT16_MIN,3471},{1570,-5419,INT16_MIN,2255},{324,-5752,INT16_MIN,90}},
+    {{-5507,-7691,INT16_MIN,INT16_MIN},{-2536,-2929,INT16_MIN,INT16_MIN},{-2337,-2518,INT16_MIN,INT16_MIN},{-2129,-2091,INT16_MIN,INT16_MIN},{-1920,-1642,INT16_MIN,INT16_MIN},{-1718,-1542,INT16_MIN,INT16_MIN},{-2149,-4759,INT16_MIN,INT16_MIN},{-2742,-5121,INT16_MIN,INT16_MIN},{-3427,-5419,INT16_MIN,INT16_MIN},{-4264,-5752,INT16_MIN,INT16_MIN}},
+    {{-5828,-7691,INT16_MIN,INT16_MIN},{-3081,-2929,INT16_MIN,INT16_MIN},{-2914,-2518,INT16_MIN,INT16_MIN},{-2742,-2091,INT16_MIN,INT16_MIN},{-2570,-1642,INT16_MIN,INT16_MIN},{-2375,-1542,INT16_MIN,INT16_MIN},{-2714,-4759,INT16_MIN,INT16_MIN},{-3265,-5121,INT16_MIN,INT16_MIN},{-3854,-5419,INT16_MIN,INT16_MIN},{-4675,-5752,INT16_MIN,INT16_MIN}},
+    {{-6126,-7691,INT16_MIN,INT16_MIN},{-3626,-2929,INT16_MIN,INT16_MIN},{-3494,-2518,INT16_MIN,INT16_MIN},{-3358,-2091,INT16_MIN,INT16_MIN},{-3220,-1642,INT16_MIN,INT16_MIN},{-3033,-1542,INT16_MIN,INT16_MIN},{-3239,-4759,INT16_MIN,INT16_MIN},{-3704,-5121,INT16_MIN,INT16_MIN},{-4294,-5419,INT16_MIN,INT16_MIN},{-5056,-5752,INT16_MIN,INT16_MIN}},
+    {{-6403,-7691,INT16_MIN,INT16_MIN},{-4175,-2929,INT16_MIN,INT16_MIN},{-4077,-2518,INT16_MIN,INT16_MIN},{-3974,-2091,INT16_MIN,INT16_MIN},{-3870,-1642,INT16_MIN,INT16_MIN},{-3690,-1542,INT16_MIN,INT16_MIN},{-3680,-4759,INT16_MIN,INT16_MIN},{-4154,-5121,INT16_MIN,INT16_MIN},{-4703,-5419,INT16_MIN,INT16_MIN},{-5410,-5752,INT16_MIN,INT16_MIN}},
+    {{-6661,-7691,INT16_MIN,INT16_MIN},{-4726,-2929,INT16_MIN,INT16_MIN},{-4660,-2518,INT16_MIN,INT16_MIN},{-4589,-2091,INT16_MIN,INT16_MIN},{-4520,-1642,INT16_MIN,INT16_MIN},{-4296,-1542,INT16_MIN,INT16_MIN},{-4133,-4759,INT16_MIN,INT16_MIN},{-4573,-5121,INT16_MIN,INT16_MIN},{-5082,-5419,INT16_MIN,INT16_MIN},{-5738,-5752,INT16_MIN,INT16_MIN}},
+    {{-6946,-6389,INT16_MIN,INT16_MIN},{-5386,-1532,INT16_MIN,INT16_MIN},{-5347,-1173,INT16_MIN,INT16_MIN},{-5305,-785,INT16_MIN,INT16_MIN},{-5213,-422,INT16_MIN,INT16_MIN},{-5076,115,INT16_MIN,INT16_MIN},{-4821,-1069,INT16_MIN,INT16_MIN},{-5048,-3832,INT16_MIN,INT16_MIN},{-5528,-4217,INT16_MIN,INT16_MIN},{-6152,-4634,INT16_MIN,INT16_MIN}},
+    {{-7432,-3779,INT16_MIN,INT16_MIN},{-6256,1210,INT16_MIN,INT16_MIN},{-6238,1477,INT16_MIN,INT16_MIN},{-6167,1765,INT16_MIN,INT16_MIN},{-6140,2021,INT16_MIN,INT16_MIN},{-6065,2833,INT16_MIN,INT16_MIN},{-5901,4001,INT16_MIN,INT16_MIN},{-5901,1054,INT16_MIN,INT16_MIN},{-6157,-1835,INT16_MIN,INT16_MIN},{-6738,-2400,INT16_MIN,INT16_MIN}},
+    {{-8119,-1165,INT16_MIN,INT16_MIN},{-7330,3854,INT16_MIN,INT16_MIN},{-7274,4036,INT16_MIN,INT16_MIN},{-7264,4224,INT16_MIN,INT16_MIN},{-7252,4421,INT16_MIN,INT16_MIN},{-7219,4959,INT16_MIN,INT16_MIN},{-7147,6164,INT16_MIN,INT16_MIN},{-7130,5939,INT16_MIN,INT16_MIN},{-7149,2861,INT16_MIN,INT16_MIN},{-7496,-166,INT16_MIN,INT16_MIN}},
+    {{-9007,1451,INT16_MIN,INT16_MIN},{-8549,6394,INT16_MIN,INT16_MIN},{-8546,6496,INT16_MIN,INT16_MIN},{-8544,6601,INT16_MIN,INT16_MIN},{-8541,6718,INT16_MIN,INT16_MIN},{-8533,7039,INT16_MIN,INT16_MIN},{-8515,7736,INT16_MIN,INT16_MIN},{-8511,7918,INT16_MIN,INT16_MIN},{-8505,7580,INT16_MIN,INT16_MIN},{-8604,4357,INT16_MIN,INT16_MIN}},
+    {{INT16_MIN,3295,INT16_MIN,INT16_MIN},{INT16_MIN,8817,INT16_MIN,INT16_MIN},{INT16_MIN,8851,INT16_MIN,INT16_MIN},{INT16_MIN,8883,INT16_MIN,INT16_MIN},{INT16_MIN,8920,INT16_MIN,INT16_MIN},{INT16_MIN,9028,INT16_MIN,INT16_MIN},{INT16_MIN,9261,INT16_MIN,INT16_MIN},{INT16_MIN,9305,INT16_MIN,INT16_MIN},{INT16_MIN,9391,INT16_MIN,INT16_MIN},{INT16_MIN,8110,INT16_MIN,INT16_MIN}},
+    {{-3225,-7691,INT16_MIN,INT16_MIN},{815,-2929,INT16_MIN,INT16_MIN},{1033,-2518,INT16_MIN,INT16_MIN},{1273,-2091,INT16_MIN,INT16_MIN},{1587,-1642,INT16_MIN,INT16_MIN},{1852,-1542,INT16_MIN,INT16_MIN},{1637,-4759,INT16_MIN,INT16_MIN},{926,-5121,INT16_MIN,INT16_MIN},{-26,-5419,INT16_MIN,INT16_MIN},{-1390,-5752,INT16_MIN,INT16_MIN}},
+    {{-3480,-7691,INT16_MIN,INT16_MIN},{463,-2929,INT16_MIN,INT16_MIN},{740,-2518,INT16_MIN,INT16_MIN},{1032,-2091,INT16_MIN,INT16_MIN},{1354,-1642,INT16_MIN,INT16_MIN},{1605,-1542,INT16_MIN,INT16_MIN},{1200,-4759,INT16_MIN,INT16_MIN},{510,-5121,INT16_MIN,INT16_MIN},{-363,-5419,INT16_MIN,INT16_MIN},{-1713,-5752,INT16_MIN,INT16_MIN}},
+    {{-3733,-7691,INT16_MIN,INT16_MIN},{220,-2929,INT16_MIN,INT16_MIN},{506,-2518,INT16_MIN,INT16_MIN},{806,-2091,INT16_MIN,INT16_MIN},{1134,-1642,INT16_MIN,INT16_MIN},{1375,-1542,INT16_MIN,INT16_MIN},{766,-4759,INT16_MIN,INT16_MIN},{141,-5121,INT16_MIN,INT16_MIN},{-738,-5419,INT16_MIN,INT16_MIN},{-2033,-5752,INT16_MIN,INT16_MIN}},
+    {{-3983,-7691,INT16_MIN,INT16_MIN},{-6,-2929,INT16_MIN,INT16_MIN},{287,-2518,INT16_MIN,INT16_MIN},{593,-2091,INT16_MIN,INT16_MIN},{930,-1642,INT16_MIN,INT16_MIN},{1161,-1542,INT16_MIN,INT16_MIN},{379,-4759,INT16_MIN,INT16_MIN},{-262,-5121,INT16_MIN,INT16_MIN},{-1108,-5419,INT16_MIN,INT16_MIN},{-2350,-5752,INT16_MIN,INT16_MIN}},
+    {{-4230,-7691,INT16_MIN,INT16_MIN},{-218,-2929,INT16_MIN,INT16_MIN},{81,-2518,INT16_MIN,INT16_MIN},{395,-2091,INT16_MIN,INT16_MIN},{741,-1642,INT16_MIN,INT16_MIN},{992,-1542,INT16_MIN,INT16_MIN},{-40,-4759,INT16_MIN,INT16_MIN},{-659,-5121,INT16_MIN,INT16_MIN},{-1473,-5419,INT16_MIN,INT16_MIN},{-2662,-5752,INT16_MIN,INT16_MIN}},
+    {{-4327,-6389,INT16_MIN,INT16_MIN},{-18,-1532,INT16_MIN,INT16_MIN},{274,-1173,INT16_MIN,INT16_MIN},{586,-785,INT16_MIN,INT16_MIN},{943,-422,INT16_MIN,INT16_MIN},{1285,115,INT16_MIN,INT16_MIN},{545,-1069,INT16_MIN,INT16_MIN},{-726,-3832,INT16_MIN,INT16_MIN},{-1483,-4217,INT16_MIN,INT16_MIN},{-2569,-4634,INT16_MIN,INT16_MIN}},
+    {{-3733,-3779,INT16_MIN,INT16_MIN},{611,1210,INT16_MIN,INT16_MIN},{882,1477,INT16_MIN,INT16_MIN},{1203,1765,INT16_MIN,INT16_MIN},{1508,2021,INT16_MIN,INT16_MIN},{1913,2833,INT16_MIN,INT16_MIN},{1719,4001,INT16_MIN,INT16_MIN},{405,1054,INT16_MIN,INT16_MIN},{-999,-1835,INT16_MIN,INT16_MIN},{-2082,-2400,INT16_MIN,INT16_MIN}},
+    {{-3135,-1165,INT16_MIN,INT16_MIN},{1216,3854,INT16_MIN,INT16_MIN},{1500,4036,INT16_MIN,INT16_MIN},{1771,4224,INT16_MIN,INT16_MIN},{2064,4421,INT16_MIN,INT16_MIN},{2405,4959,INT16_MIN,INT16_MIN},{2221,6164,INT16_MIN,INT16_MIN},{1533,5939,INT16_MIN,INT16_MIN},{82,2861,INT16_MIN,INT16_MIN},{-1571,-166,INT16_MIN,INT16_MIN}},
+    {{-2534,1451,INT16_MIN,INT16_MIN},{1831,6394,INT16_MIN,INT16_MIN},{2070,6496,INT16_MIN,INT16_MIN},{2321,6601,INT16_MIN,INT16_MIN},{2595,6718,INT16_MIN,INT16_MIN},{2886,7039,INT16_MIN,INT16_MIN},{2577,7736,INT16_MIN,INT16_MIN},{1979,7918,INT16_MIN,INT16_MIN},{1162,7580,INT16_MIN,INT16_MIN},{-535,4357,INT16_MIN,INT16_MIN}},
+    {{INT16_MIN,3295,INT16_MIN,INT16_MIN},{INT16_MIN,8817,INT16_MIN,INT16_MIN},{INT16_MIN,8851,INT16_MIN,INT16_MIN},{INT16_MIN,8883,INT16_MIN,INT16_MIN},{INT16_MIN,8920,INT16_MIN,INT16_MIN},{INT16_MIN,9028,INT16_MIN,INT16_MIN},{INT16_MIN,9261,INT16_MIN,INT16_MIN},{INT16_MIN,9305,INT16_MIN,INT16_MIN},{INT16_MIN,9391,INT16_MIN,INT16_MIN},{INT16_MIN,8110,INT16_MIN,INT16_MIN}},
+    {{-3225,-7691,-5385,INT16_MIN},{815,-2929,4725,INT16_MIN},{1033,-2518,5202,INT16_MIN},{1273,-2091,5698,INT16_MIN},{1587,-1642,6208,INT16_MIN},{1852,-1542,6685,INT16_MIN},{1637,-4759,4620,INT16_MIN},{926,-5121,3471,INT16_MIN},{-26,-5419,2255,INT16_MIN},{-1390,-5752,90,INT16_MIN}},
+    {{-4839,-7691,-8991,INT16_MIN},{-1150,-2929,-887,INT16_MIN},{-823,-2518,-245,INT16_MIN},{-479,-2091,473,INT16_MIN},{-99,-1642,1348,INT16_MIN},{103,-1542,1919,INT16_MIN},{-900,-4759,-95,INT16_MIN},{-1589,-5121,-1783,INT16_MIN},{-2397,-5419,-3682,INT16_MIN},{-3421,-5752,-5971,INT16_MIN}},
+    {{-5192,-7691,-9330,INT16_MIN},{-1412,-2929,-1380,INT16_MIN},{-1075,-2518,-625,INT16_MIN},{-719,-2091,189,INT16_MIN},{-326,-1642,1073,INT16_MIN},{-127,-1542,1621,INT16_MIN},{-1513,-4759,-714,INT16_MIN},{-2167,-5121,-2343,INT16_MIN},{-2917,-5419,-4135,INT16_MIN},{-3870,-5752,-6401,INT16_MIN}},
+    {{-4455,-7691,-9677,INT16_MIN},{-226,-2929,-1668,INT16_MIN},{75,-2518,-902,INT16_MIN},{407,-2091,-78,INT16_MIN},{742,-1642,813,INT16_MIN},{1155,-1542,1340,INT16_MIN},{832,-4759,-1336,INT16_MIN},{-594,-5121,-2860,INT16_MIN},{-2097,-5419,-4646,INT16_MIN},{-3060,-5752,-6842,INT16_MIN}},
+    {{-2534,-7691,-10029,-6291},{1831,-2929,-1936,3604},{2070,-2518,-1161,4112},{2321,-2091,-327,4643},{2595,-1642,568,5190},{2886,-1542,1092,5773},{2577,-4759,-1906,3938},{1979,-5121,-3434,2853},{1162,-5419,-5165,1440},{-535,-5752,-7290,-1628}},
+    {{-5507,-7691,-10383,INT16_MIN},{-2536,-2929,-2192,INT16_MIN},{-2337,-2518,-1406,INT16_MIN},{-2129,-2091,-568,INT16_MIN},{-1920,-1642,347,INT16_MIN},{-1718,-1542,893,INT16_MIN},{-2149,-4759,-2554,INT16_MIN},{-2742,-5121,-4016,INT16_MIN},{-3427,-5419,-5685,INT16_MIN},{-4264,-5752,-7740,INT16_MIN}},
+    {{-6126,-7691,-10467,INT16_MIN},{-3626,-2929,-1562,INT16_MIN},{-3494,-2518,-804,INT16_MIN},{-3358,-2091,28,INT16_MIN},{-3220,-1642,936,INT16_MIN},{-3033,-1542,1738,INT16_MIN},{-3239,-4759,-894,INT16_MIN},{-3704,-5121,-3896,INT16_MIN},{-4294,-5419,-5536,INT16_MIN},{-5056,-5752,-7402,INT16_MIN}},
+    {{-6661,-7691,-8911,INT16_MIN},{-4726,-2929,173,INT16_MIN},{-4660,-2518,851,INT16_MIN},{-4589,-2091,1612,INT16_MIN},{-4520,-1642,2363,INT16_MIN},{-4296,-1542,3270,INT16_MIN},{-4133,-4759,2137,INT16_MIN},{-4573,-5121,-871,INT16_MIN},{-5082,-5419,-4045,INT16_MIN},{-5738,-5752,-6120,INT16_MIN}},
+    {{-7432,-3779,-7099,INT16_MIN},{-6256,1210,1821,INT16_MIN},{-6238,1477,2438,INT16_MIN},{-6167,1765,3052,INT16_MIN},{-6140,2021,3709,INT16_MIN},{-6065,2833,4449,INT16_MIN},{-5901,4001,3726,INT16_MIN},{-5901,1054,2167,INT16_MIN},{-6157,-1835,-937,INT16_MIN},{-6738,-2400,-4342,INT16_MIN}},
+    {{-9007,1451,-5068,INT16_MIN},{-8549,6394,3662,INT16_MIN},{-8546,6496,4140,INT16_MIN},{-8544,6601,4643,INT16_MIN},{-8541,6718,5190,INT16_MIN},{-8533,7039,5773,INT16_MIN},{-8515,7736,5154,INT16_MIN},{-8511,7918,3959,INT16_MIN},{-8505,7580,2324,INT16_MIN},{-8604,4357,-1070,INT16_MIN}},
+};
+
+}} // ns blackjack::hint
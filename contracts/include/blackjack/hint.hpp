@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <climits>
+
+#include <blackjack/card.hpp>
+#include <blackjack/ev_table.hpp>
+
+// Decision EVs of a hand, looked up in the table generated by tools/strategy/strategy_gen
+namespace blackjack { namespace hint {
+
+using card_game::card;
+using card_game::cards_t;
+
+const int16_t unavailable = INT16_MIN;
+
+// indexed by decision: hit, stand, split, double down
+using evs_t = std::array<int16_t, 4>;
+
+inline int get_class(const cards_t& cards) {
+    int hard = 0;
+    for (const auto& c : cards) {
+        hard += card_game::get_weight(c);
+    }
+    const int w = card_game::get_weight(cards);
+    if (cards.size() == 2 && card_game::get_weight(cards[0]) == card_game::get_weight(cards[1])) {
+        return hard_classes + soft_classes + card_game::get_weight(cards[0]) - 1;
+    }
+    if (w != hard) {
+        return hard_classes + w - 12;
+    }
+    return std::max(w, 4) - 4;
+}
+
+inline evs_t get(const cards_t& cards, const card& up_card, bool can_split) {
+    const auto& row = evs[get_class(cards)][card_game::get_weight(up_card) - 1];
+    evs_t res{row[0], row[1], row[2], row[3]};
+    if (!can_split) {
+        res[2] = unavailable;
+    }
+    if (cards.size() != 2) {
+        res[3] = unavailable;
+    }
+    return res;
+}
+
+}} // ns blackjack::hint
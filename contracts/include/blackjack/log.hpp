@@ -0,0 +1,29 @@
+#pragma once
+
+#include <eosio/print.hpp>
+
+// Compile-time logging levels. Disabled levels expand to nothing,
+// so their arguments aren't even evaluated.
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_INFO  1
+#define LOG_LEVEL_DEBUG 2
+
+#ifndef LOG_LEVEL
+#ifdef IS_DEBUG
+#define LOG_LEVEL LOG_LEVEL_DEBUG
+#else
+#define LOG_LEVEL LOG_LEVEL_NONE
+#endif
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) eosio::print_f(__VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) eosio::print_f(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
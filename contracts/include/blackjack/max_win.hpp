@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+
+#include <blackjack/card.hpp>
+
+// Exact maximum of the player's win that is still reachable from the current state of a box.
+// Amounts are plain integers so the same code is used by the contract and by native tests.
+namespace blackjack { namespace reserve {
+
+using card_game::card;
+using card_game::cards_t;
+
+// the cards of a box together with the stakes on them
+struct box_view {
+    const cards_t& active_cards;
+    int64_t active_stake;
+    const cards_t& split_cards;
+    int64_t split_stake;
+    bool second_round;
+    // initial ante of the box
+    int64_t ante;
+    // settled side bets win
+    int64_t side_bets_win;
+    // player can still make a decision on the active hand
+    bool playable;
+};
+
+// the best case for the player after splitting is doubling on every hand
+inline int64_t split_hand(const card& c, int64_t ante) {
+    // only one card is dealt on each split ace
+    if (c.get_rank() == card_game::rank::ACE) {
+        return ante;
+    }
+    // a ten value card never makes a hard 9-11
+    return card_game::get_weight(c) <= 9 ? 2 * ante : ante;
+}
+
+inline bool can_double(const cards_t& cards, int64_t stake, int64_t ante) {
+    const auto w = card_game::get_weight(cards);
+    return cards.size() == 2 && stake == ante && 9 <= w && w <= 11 && card_game::is_hard(cards);
+}
+
+inline int64_t hand(const cards_t& cards, int64_t stake, int64_t ante, bool playable) {
+    if (cards.size() == 1) {
+        // split hand waiting for its second card
+        return split_hand(cards[0], ante);
+    }
+    if (card_game::get_weight(cards) > 21) {
+        return -stake;
+    }
+    // dealer may always bust, so any standing hand can win
+    return playable && can_double(cards, stake, ante) ? 2 * stake : stake;
+}
+
+inline int64_t undealt_box(int64_t ante, int64_t pair, int64_t first_three) {
+    // suited three of a kind on a suited pair, then split and double both hands
+    return 4 * ante + 25 * pair + 100 * first_three;
+}
+
+inline int64_t box(const box_view& b) {
+    int64_t main_win = 0;
+    if (b.split_cards.empty()) {
+        const auto& cards = b.active_cards;
+        if (cards.size() == 2 && card_game::get_weight(cards) == 21) {
+            // blackjack pays 3:2
+            main_win = 3 * b.active_stake / 2;
+        } else {
+            main_win = hand(cards, b.active_stake, b.ante, b.playable);
+            if (b.playable && cards.size() == 2 && card_game::get_weight(cards[0]) == card_game::get_weight(cards[1])) {
+                main_win = std::max(main_win, 2 * split_hand(cards[0], b.ante));
+            }
+        }
+    } else {
+        const bool aces = b.active_cards[0].get_rank() == card_game::rank::ACE;
+        if (aces) {
+            // the box is finished right after the split
+            main_win = hand(b.active_cards, b.active_stake, b.ante, false) + hand(b.split_cards, b.split_stake, b.ante, false);
+        } else if (b.second_round) {
+            main_win = hand(b.active_cards, b.active_stake, b.ante, b.playable) + hand(b.split_cards, b.split_stake, b.ante, false);
+        } else {
+            // the second hand hasn't been played yet
+            main_win = hand(b.active_cards, b.active_stake, b.ante, b.playable) + hand(b.split_cards, b.split_stake, b.ante, true);
+        }
+    }
+    return main_win + b.side_bets_win;
+}
+
+}} // ns blackjack::reserve
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <algorithm>
+
+#include <blackjack/card.hpp>
+
+// Compact encoding of game messages.
+//
+// Layout: [version][count][card]...[count][card]... where every field is one byte,
+// a message consists of a player's cards group followed by a dealer's cards group.
+// Bytes are packed into little-endian 64-bit params, so the serialized params
+// are exactly the byte stream padded with zeros to a multiple of 8.
+namespace blackjack { namespace message {
+
+using card_game::card;
+using card_game::cards_t;
+
+const uint8_t version = 1;
+
+class writer {
+public:
+    writer& put(uint8_t byte) {
+        if (pos % 8 == 0) {
+            words.push_back(0);
+        }
+        words.back() |= uint64_t(byte) << (8 * (pos % 8));
+        pos++;
+        return *this;
+    }
+
+    writer& put(const cards_t& cards) {
+        put(cards.size());
+        for (const auto& c : cards) {
+            put(c.get_value());
+        }
+        return *this;
+    }
+
+    std::vector<uint64_t> get() {
+        return std::move(words);
+    }
+
+private:
+    std::vector<uint64_t> words;
+    size_t pos = 0;
+};
+
+inline std::vector<uint64_t> encode(const cards_t& player_cards, const cards_t& dealer_cards) {
+    writer w;
+    w.put(version).put(player_cards).put(dealer_cards);
+    return w.get();
+}
+
+// reads a message in place, without unpacking the params
+class reader {
+public:
+    reader(const uint8_t* data, size_t size): data(data), size(size) {}
+
+    bool empty() const {
+        return size == 0;
+    }
+
+    bool valid() const {
+        return size > 0 && data[0] == version;
+    }
+
+    uint8_t get() {
+        return pos < size ? data[pos++] : 0;
+    }
+
+    cards_t get_cards() {
+        cards_t cards(get());
+        for (auto& c : cards) {
+            c = card(get());
+        }
+        return cards;
+    }
+
+    // returns player's and dealer's cards
+    std::pair<cards_t, cards_t> decode() {
+        pos = 1;
+        auto player_cards = get_cards();
+        auto dealer_cards = get_cards();
+        return {std::move(player_cards), std::move(dealer_cards)};
+    }
+
+    // raw bytes of serialized params start with the varint length
+    static reader from_serialized(const char* bytes, size_t len) {
+        size_t i = 0;
+        uint64_t words = 0;
+        for (int shift = 0; i < len; shift += 7) {
+            const uint8_t b = bytes[i++];
+            words |= uint64_t(b & 0x7f) << shift;
+            if (!(b & 0x80)) {
+                break;
+            }
+        }
+        const size_t size = std::min<size_t>(8 * words, len - i);
+        return reader(reinterpret_cast<const uint8_t*>(bytes + i), size);
+    }
+
+private:
+    const uint8_t* data;
+    size_t size;
+    size_t pos = 0;
+};
+
+}} // ns blackjack::message
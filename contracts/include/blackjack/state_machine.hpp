@@ -0,0 +1,115 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// Game state machine. It's plain constexpr data, so the contract and native tools follow the same rules.
+namespace blackjack { namespace fsm {
+
+enum game_state : uint16_t {
+    require_bet,
+    require_play,
+    deal_one_card,
+    stand,
+    double_down,
+    split,
+    deal_cards,
+    // never stored, the game is over
+    finished,
+};
+
+const int states_count = finished + 1;
+
+enum class event : uint8_t {
+    bet,
+    hit,
+    stand,
+    split,
+    double_down,
+    random,
+};
+
+const int events_count = static_cast<int>(event::random) + 1;
+
+const uint8_t illegal = 0xff;
+
+using transitions_t = std::array<std::array<uint8_t, events_count>, states_count>;
+
+// next state for every (state, event) pair.
+// A random may also finish the game from any state that awaits it,
+// a stand that moves play to the next hand keeps require_play.
+constexpr transitions_t transitions{{
+    //                   bet         hit            stand    split    double_down  random
+    /* require_bet   */ {deal_cards, illegal,       illegal, illegal, illegal,     illegal},
+    /* require_play  */ {illegal,    deal_one_card, stand,   split,   double_down, illegal},
+    /* deal_one_card */ {illegal,    illegal,       illegal, illegal, illegal,     require_play},
+    /* stand         */ {illegal,    illegal,       illegal, illegal, illegal,     finished},
+    /* double_down   */ {illegal,    illegal,       illegal, illegal, illegal,     require_play},
+    /* split         */ {illegal,    illegal,       illegal, illegal, illegal,     require_play},
+    /* deal_cards    */ {illegal,    illegal,       illegal, illegal, illegal,     require_play},
+    /* finished      */ {illegal,    illegal,       illegal, illegal, illegal,     illegal},
+}};
+
+constexpr uint8_t next(uint16_t state, event e) {
+    return state < states_count ? transitions[state][static_cast<int>(e)] : illegal;
+}
+
+constexpr bool is_allowed(uint16_t state, event e) {
+    return next(state, e) != illegal;
+}
+
+constexpr bool awaits_random(uint16_t state) {
+    return is_allowed(state, event::random);
+}
+
+constexpr bool awaits_action(uint16_t state) {
+    for (int e = 0; e < events_count; e++) {
+        if (event(e) != event::random && is_allowed(state, event(e))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// every state but the final one waits either for the player or for a random, never for both
+constexpr bool no_dead_ends() {
+    for (int s = 0; s < states_count; s++) {
+        if ((s == finished) != (!awaits_random(s) && !awaits_action(s))) {
+            return false;
+        }
+        if (awaits_random(s) && awaits_action(s)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// every state is reachable from require_bet and no transition leads back to it
+constexpr bool all_reachable() {
+    bool reached[states_count] = {};
+    reached[require_bet] = true;
+    for (int pass = 0; pass < states_count; pass++) {
+        for (int s = 0; s < states_count; s++) {
+            for (int e = 0; reached[s] && e < events_count; e++) {
+                const auto to = transitions[s][e];
+                if (to == require_bet) {
+                    return false;
+                }
+                if (to != illegal) {
+                    reached[to] = true;
+                }
+            }
+        }
+    }
+    for (int s = 0; s < states_count; s++) {
+        if (!reached[s]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(no_dead_ends(), "every state should wait either for an action or for a random");
+static_assert(all_reachable(), "every state should be reachable from require_bet");
+
+}} // ns blackjack::fsm
@@ -4,7 +4,7 @@
 
 namespace blackjack {
 
-param_t blackjack::get_and_check(uint64_t ses_id, uint16_t param, const std::string& error_msg) const {
+param_t blackjack::get_and_check(uint64_t ses_id, uint16_t param, const char* error_msg) const {
     const auto res = get_param_value(ses_id, param);
     if (res != std::nullopt) {
         return *res;
@@ -18,8 +18,10 @@ void blackjack::check_params(uint64_t ses_id) const {
     const auto max_ante_bet = get_and_check(ses_id, param::max_ante, "max ante bet is absent");
     const auto max_payout = get_and_check(ses_id, param::max_payout, "max payout is absent");
     check(max_ante_bet >= min_ante_bet, "max ante bet is less than min");
-    check(min_ante_bet <= get_session(ses_id).deposit.amount, "deposit is less than min bet");
-    check(max_payout >= get_session(ses_id).deposit.amount, "deposit exceeds max payout");
+    const auto deposit = get_session(ses_id).deposit.amount;
+    check(deposit > 0, "deposit should be positive");
+    check(min_ante_bet <= static_cast<uint64_t>(deposit), "deposit is less than min bet");
+    check(max_payout >= static_cast<uint64_t>(deposit), "deposit exceeds max payout");
 }
 
 void blackjack::check_bet(uint64_t ses_id, const param_t& ante, const param_t& pair, const param_t& first_three) const {
@@ -27,48 +29,55 @@ void blackjack::check_bet(uint64_t ses_id, const param_t& ante, const param_t& p
     check(*get_param_value(ses_id, param::max_ante) >= ante, "ante bet is more than max");
     check(get_and_check(ses_id, param::max_pair, "max pair is absent") >= pair, "pair bet is more than max");
     check(get_and_check(ses_id, param::max_first_three, "max first three is absent") >= first_three, "first three bet is more than max");
-    check(ante + pair + first_three == get_session(ses_id).deposit.amount, "bet sum doesn't equal to deposit");
 }
 
-std::tuple<blackjack::outcome, cards_t, cards_t> blackjack::deal_initial_cards(state_table::const_iterator state_itr, const checksum256& rand) {
-    const auto deck = prepare_deck(state_itr, rand);
-    const cards_t active_cards{card(deck[0]), card(deck[1])};
-    const auto open_card = card(deck[2]);
-
-    if (card_game::get_weight(active_cards) == 21) {
-        // player hits a blackjack at the start of the game
-        const auto hole_card = card(deck[3]);
-        const cards_t dealer_cards{open_card, hole_card};
-        if (card_game::get_weight(dealer_cards) == 21) {
-            return std::make_tuple(outcome::draw, active_cards, dealer_cards);
+std::tuple<cards_t, cards_t> blackjack::deal_initial_cards(state_table::const_iterator state_itr, const checksum256& rand) {
+    auto deck = prepare_deck(state_itr, rand);
+    const auto boxes = state_itr->boxes.size();
+    cards_t player_cards;
+    player_cards.reserve(2 * boxes);
+    bool all_blackjacks = true;
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        for (size_t i = 0; i < boxes; i++) {
+            auto& box = row.boxes[i];
+            box.active_cards = cards_t{deck.take(), deck.take()};
+            player_cards.insert(player_cards.end(), box.active_cards.begin(), box.active_cards.end());
+            all_blackjacks = all_blackjacks && box.has_blackjack();
         }
-        return std::make_tuple(outcome::player, active_cards, dealer_cards);
-    }
+        row.dealer_card = deck.take();
+        // boxes with a blackjack wait for the dealer
+        while (row.active_box < boxes && row.boxes[row.active_box].has_blackjack()) {
+            row.active_box++;
+        }
+    });
+
+    cards_t dealt = player_cards;
+    dealt.push_back(state_itr->dealer_card);
+    take_from_casino_shoe(state_itr->ses_id, dealt);
 
+    if (all_blackjacks) {
+        // player hits a blackjack in every box at the start of the game
+        const auto hole_card = deck.take();
+        return std::make_tuple(player_cards, cards_t{state_itr->dealer_card, hole_card});
+    }
     // hole card returns to the deck
-    state.modify(state_itr, get_self(), [&](auto& row) {
-        row.active_cards = active_cards;
-        row.dealer_card = open_card;
-    });
-    return std::make_tuple(outcome::carry_on, active_cards, cards_t{open_card});
+    return std::make_tuple(player_cards, cards_t{state_itr->dealer_card});
 }
 
-std::tuple<blackjack::outcome, card, labels_t> blackjack::deal_a_card(state_table::const_iterator state_itr, const checksum256& rand) {
+std::tuple<blackjack::outcome, card, blackjack::deck_t> blackjack::deal_a_card(state_table::const_iterator state_itr, const checksum256& rand) {
     auto deck = prepare_deck(state_itr, rand);
-    const auto new_card = card(*deck.begin());
-    deck.erase(deck.begin());
-    auto active_cards = state_itr->active_cards;
-    active_cards.push_back(new_card);
+    const auto new_card = deck.take();
 
     state.modify(state_itr, get_self(), [&](auto& row) {
-        row.active_cards = active_cards;
+        row.boxes[row.active_box].active_cards.push_back(new_card);
     });
+    take_from_casino_shoe(state_itr->ses_id, {new_card});
 
-    if (card_game::get_weight(active_cards) > 21) {
+    if (card_game::get_weight(state_itr->active().active_cards) > 21) {
         // player gets busted
-        return std::make_tuple(outcome::dealer, new_card, deck);
+        return std::make_tuple(outcome::dealer, new_card, std::move(deck));
     }
-    return std::make_tuple(outcome::carry_on, new_card, deck);
+    return std::make_tuple(outcome::carry_on, new_card, std::move(deck));
 }
 
 std::tuple<blackjack::outcome, bool> blackjack::compare_cards(const cards_t& active_cards, const cards_t& dealer_cards, bool has_split) {
@@ -97,13 +106,11 @@ std::tuple<blackjack::outcome, bool> blackjack::compare_cards(const cards_t& act
     return std::make_tuple(outcome::player, player_has_a_blackjack);
 }
 
-cards_t blackjack::open_dealer_cards(state_table::const_iterator state_itr, const checksum256& rand, labels_t& deck) {
+cards_t blackjack::open_dealer_cards(state_table::const_iterator state_itr, const checksum256& rand, deck_t& deck) {
     cards_t dealer_cards{state_itr->dealer_card};
     // dealer should stand on soft 17
     for (int i = 0; card_game::get_weight(dealer_cards) <= 16; i++) {
-        check(!deck.empty(), "empty deck while opening dealer's cards");
-        dealer_cards.push_back(card(*deck.begin()));
-        deck.erase(deck.begin());
+        dealer_cards.push_back(deck.take());
     }
     return dealer_cards;
 }
@@ -151,247 +158,402 @@ asset get_first_three_win(cards_t player_cards, card third_card, asset qty) {
     }
 }
 
-std::tuple<asset, cards_t> blackjack::compare_and_finish(state_table::const_iterator state_itr, asset ante, const checksum256& rand, labels_t&& deck) {
+std::tuple<asset, cards_t> blackjack::compare_and_finish(state_table::const_iterator state_itr, const checksum256& rand, deck_t&& deck) {
     // returns players win & dealer's cards
     auto dealer_cards = open_dealer_cards(state_itr, rand, deck);
-    auto has_split = state_itr->has_split();
-    auto [res, bjack] = compare_cards(state_itr->active_cards, dealer_cards, has_split);
-    auto player_win = get_win(ante, res, bjack);
-    eosio::print_f("player's 1st round win: %s\n", player_win.to_string());
-    if (has_split) {
-        std::tie(res, bjack) = compare_cards(state_itr->split_cards, dealer_cards, true);
-        const auto split_win = get_win(state_itr->first_round_ante, res, bjack);
-        player_win += split_win;
-        eosio::print_f("player's 2nd round win: %s\n", split_win.to_string());
+    asset player_win = zero_asset;
+    for (const auto& box : state_itr->boxes) {
+        auto has_split = box.has_split();
+        auto [res, bjack] = compare_cards(box.active_cards, dealer_cards, has_split);
+        auto box_win = get_win(box.ante, res, bjack);
+        LOG_INFO("player's 1st round win: %\n", box_win);
+        if (has_split) {
+            std::tie(res, bjack) = compare_cards(box.split_cards, dealer_cards, true);
+            const auto split_win = get_win(box.first_round_ante, res, bjack);
+            box_win += split_win;
+            LOG_INFO("player's 2nd round win: %\n", split_win);
+        }
+        // side bets
+        player_win += box_win + box.pair_win + box.first_three_win;
     }
     // the first card isn't new. it's been dealt at the begining
     dealer_cards.erase(dealer_cards.begin());
-    // side bets
-    player_win += state_itr->pair_win + state_itr->first_three_win;
     return std::make_tuple(player_win, std::move(dealer_cards));
 }
 
-inline void blackjack::check_deposit(asset deposit, asset current_ante, asset prev_round_ante, asset side_bets) {
-    eosio::print_f("deposit: %s, current ante: %s, prev round ante: %s\n", deposit, current_ante, prev_round_ante);
-    check(deposit == current_ante + prev_round_ante + side_bets, "invalid deposit");
+void blackjack::update_stats(uint64_t ses_id, asset win, asset payout_cut) {
+    const auto state_itr = state.require_find(ses_id, "invalid ses_id");
+    const auto bet_itr = bet.require_find(ses_id, "invalid ses_id");
+    const uint64_t shard = ses_id % STATS_SHARDS;
+    auto stats_itr = stats.find(shard);
+    if (stats_itr == stats.end()) {
+        stats_itr = stats.emplace(get_self(), [&](auto& row) {
+            row.shard = shard;
+            row.ante_wagered = zero_asset;
+            row.ante_paid = zero_asset;
+            row.side_bets_wagered = zero_asset;
+            row.side_bets_paid = zero_asset;
+            row.payout_cut = zero_asset;
+            row.first_three_hits.resize(static_cast<int>(combination::SUITED_THREE_OF_A_KIND) + 1);
+        });
+    }
+    stats.modify(stats_itr, get_self(), [&](auto& row) {
+        row.rounds++;
+        row.payout_cut += payout_cut;
+        // win consists of the main game win and the side bets win
+        asset main_win = win;
+        for (size_t i = 0; i < state_itr->boxes.size(); i++) {
+            const auto& box = state_itr->boxes[i];
+            const auto& box_bet = bet_itr->boxes[i];
+            const auto side_bets_win = box.pair_win + box.first_three_win;
+            row.boxes++;
+            row.ante_wagered += box.ante + box.first_round_ante;
+            row.ante_paid += box.ante + box.first_round_ante;
+            row.side_bets_wagered += box_bet.pair + box_bet.first_three;
+            row.side_bets_paid += box_bet.pair + box_bet.first_three + side_bets_win;
+            main_win -= side_bets_win;
+
+            row.blackjacks += box.has_blackjack();
+            row.splits += box.has_split();
+            // a zero ante box looks doubled, and first_round_ante is only staked by a split
+            if (box_bet.ante.amount > 0) {
+                row.doubles += (box.ante == 2 * box_bet.ante) + (box.has_split() && box.first_round_ante == 2 * box_bet.ante);
+            }
+            row.busts += card_game::get_weight(box.active_cards) > 21;
+            if (box.has_split()) {
+                row.busts += card_game::get_weight(box.split_cards) > 21;
+            }
+            // the first two cards of the box and the dealer's open card
+            const cards_t first_three{
+                box.active_cards[0],
+                box.has_split() ? box.split_cards[0] : box.active_cards[1],
+                state_itr->dealer_card
+            };
+            row.first_three_hits[static_cast<int>(get_combination(first_three))]++;
+        }
+        row.ante_paid += main_win;
+    });
+}
+
+inline void blackjack::check_deposit(asset deposit, asset staked_sum, asset side_bets) {
+    LOG_DEBUG("deposit: %, staked: %, side bets: %\n", deposit, staked_sum, side_bets);
+    check(deposit == staked_sum + side_bets, "invalid deposit");
 }
 
 void blackjack::on_new_game(uint64_t ses_id) {
     check_params(ses_id);
     require_action(action::bet);
-    state.emplace(get_self(), [&](auto& row) {
+    const auto state_itr = state.emplace(get_self(), [&](auto& row) {
         row.ses_id = ses_id;
         row.state = game_state::require_bet;
-        row.first_round_ante = zero_asset;
-        row.pair_win = zero_asset;
-        row.first_three_win = zero_asset;
         row.max_player_win = zero_asset;
     });
+    if (continuous_shuffle(ses_id) && !casino_shuffles(get_session(ses_id).casino_id)) {
+        // the casino hasn't opted in, the session never touches its machine
+        detach_from_casino_shoe(state_itr);
+    }
 }
 
 void blackjack::on_action(uint64_t ses_id, uint16_t type, std::vector<game_sdk::param_t> params) {
+    // player's decisions map to events in the order of the decision constants
+    static constexpr fsm::event decision_events[] = {
+        fsm::event::hit,
+        fsm::event::stand,
+        fsm::event::split,
+        fsm::event::double_down,
+    };
+    static constexpr action_handler handlers[fsm::events_count] = {
+        &blackjack::on_bet,
+        &blackjack::on_hit,
+        &blackjack::on_stand,
+        &blackjack::on_split,
+        &blackjack::on_double_down,
+        nullptr,
+    };
+
     const auto state_itr = state.require_find(ses_id, "invalid ses_id");
-    if (type == action::bet) {
-        check(state_itr->state == game_state::require_bet, "game state should be require_bet");
-        check(params.size() == 3, "invalid param size");
-        check_bet(ses_id, params[0], params[1], params[2]);
-        const auto bet_itr = bet.emplace(get_self(), [&](auto& row) {
-            row.ses_id = ses_id;
-            row.ante = asset(params[0], core_symbol);
-            row.pair = asset(params[1], core_symbol);
-            row.first_three = asset(params[2], core_symbol);
-        });
-        update_state(state_itr, game_state::deal_cards);
-        update_max_win(ses_id, 4 * bet_itr->ante + 4 * bet_itr->ante + 25 * bet_itr->pair + 100 * bet_itr->first_three);
-    } else if (type == action::play) {
-        check(state_itr->state == game_state::require_play, "game state should be require_play");
+    check(type == action::bet || type == action::play, "invalid action");
+    auto e = fsm::event::bet;
+    if (type == action::play) {
         check(params.size() == 1, "invalid param size");
-        const auto bet_itr = bet.require_find(ses_id, "invalid ses_id");
-        const auto ante = bet_itr->ante;
-        switch (params[0]) {
-            case decision::hit:
-                update_state(state_itr, game_state::deal_one_card);
-                break;
-            case decision::stand:
-                // if it's a first round and player has splitted then just save the cards
-                if (state_itr->has_split() && !state_itr->second_round) {
-                    eosio::print("player stands and swaps active cards\n");
-                    finish_first_round(state_itr);
-                    require_action(action::play, true);
-                    return;
-                }
-                update_state(state_itr, game_state::stand);
-                break;
-            case decision::split:
-                check(!state_itr->has_split(), "cannot split again");
-                check(state_itr->active_cards.size() == 2, "cannot split");
-                check(card_game::get_weight(state_itr->active_cards[0]) ==
-                      card_game::get_weight(state_itr->active_cards[1]), "cannot split cards with different weights");
-                check_deposit(get_session(ses_id).deposit, ante * 2, zero_asset, bet_itr->side_bets_sum());
-                // split cards
-                state.modify(state_itr, get_self(), [&](auto& row) {
-                    row.split_cards.push_back(row.active_cards.back());
-                    row.active_cards.pop_back();
-                    row.first_round_ante = ante;
-                });
-                update_state(state_itr, game_state::split);
-                break;
-            case decision::double_down: {
-                check(!state_itr->has_hit(), "player's already hit");
-                check(!state_itr->active_cards.empty(), "cards have not been dealt yet");
-                const auto& cards = state_itr->active_cards;
-                // https://wizardofodds.com/games/blackjack/strategy/european/
-                const auto w = card_game::get_weight(cards);
-                const auto hard = card_game::is_hard(cards);
-                check(9 <= w && w <= 11 && hard, "player may only double on hard totals of 9-11");
-                check_deposit(get_session(ses_id).deposit, ante * 2, state_itr->first_round_ante, bet_itr->side_bets_sum());
-                update_state(state_itr, game_state::double_down);
-                break;
-            }
-            default:
-                check(0, "invalid decision");
-        }
-    } else {
-        check(0, "invalid action");
+        check(params[0] < std::size(decision_events), "invalid decision");
+        e = decision_events[params[0]];
+    }
+    check(fsm::is_allowed(state_itr->state, e), "action isn't allowed in the current game state");
+
+    if (!(this->*handlers[static_cast<int>(e)])(state_itr, params)) {
+        return;
     }
+    update_state(state_itr, e);
+    update_max_win(ses_id);
     // random for next card(s)
     require_random();
 }
 
+bool blackjack::on_bet(state_table::const_iterator state_itr, const std::vector<param_t>& params) {
+    const auto ses_id = state_itr->ses_id;
+    // ante, pair and first three bets for every box
+    check(!params.empty() && params.size() % 3 == 0, "invalid param size");
+    check(params.size() / 3 <= max_boxes, "too many boxes");
+    param_t bet_sum = 0;
+    for (size_t i = 0; i < params.size(); i += 3) {
+        check_bet(ses_id, params[i], params[i + 1], params[i + 2]);
+        bet_sum += params[i] + params[i + 1] + params[i + 2];
+    }
+    const auto deposit = get_session(ses_id).deposit.amount;
+    check(deposit > 0, "deposit should be positive");
+    check(bet_sum == static_cast<uint64_t>(deposit), "bet sum doesn't equal to deposit");
+    const auto bet_itr = bet.emplace(get_self(), [&](auto& row) {
+        row.ses_id = ses_id;
+        for (size_t i = 0; i < params.size(); i += 3) {
+            row.boxes.push_back(box_bet{
+                asset(params[i], core_symbol),
+                asset(params[i + 1], core_symbol),
+                asset(params[i + 2], core_symbol)
+            });
+        }
+    });
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        for (const auto& box_bet : bet_itr->boxes) {
+            box_state box;
+            box.ante = box_bet.ante;
+            box.first_round_ante = zero_asset;
+            box.pair_win = zero_asset;
+            box.first_three_win = zero_asset;
+            row.boxes.push_back(box);
+        }
+    });
+    return true;
+}
+
+bool blackjack::on_hit([[maybe_unused]] state_table::const_iterator state_itr,
+                       [[maybe_unused]] const std::vector<param_t>& params) {
+    return true;
+}
+
+bool blackjack::on_stand(state_table::const_iterator state_itr, [[maybe_unused]] const std::vector<param_t>& params) {
+    // if it's a first round and player has splitted or there are boxes left then just save the cards
+    if (next_hand(state_itr)) {
+        LOG_DEBUG("player stands and moves to the next hand\n");
+        update_max_win(state_itr->ses_id);
+        require_action(action::play, true);
+        return false;
+    }
+    return true;
+}
+
+bool blackjack::on_split(state_table::const_iterator state_itr, [[maybe_unused]] const std::vector<param_t>& params) {
+    const auto bet_itr = bet.require_find(state_itr->ses_id, "invalid ses_id");
+    const auto& box = state_itr->active();
+    check(!box.has_split(), "cannot split again");
+    check(box.active_cards.size() == 2, "cannot split");
+    check(card_game::get_weight(box.active_cards[0]) ==
+          card_game::get_weight(box.active_cards[1]), "cannot split cards with different weights");
+    check_deposit(get_session(state_itr->ses_id).deposit, state_itr->staked_sum() + box.ante, bet_itr->side_bets_sum());
+    // split cards
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        auto& box = row.boxes[row.active_box];
+        box.split_cards.push_back(box.active_cards.back());
+        box.active_cards.pop_back();
+        box.first_round_ante = box.ante;
+    });
+    return true;
+}
+
+bool blackjack::on_double_down(state_table::const_iterator state_itr, [[maybe_unused]] const std::vector<param_t>& params) {
+    const auto bet_itr = bet.require_find(state_itr->ses_id, "invalid ses_id");
+    const auto& box = state_itr->active();
+    check(!box.has_hit(), "player's already hit");
+    check(!box.active_cards.empty(), "cards have not been dealt yet");
+    const auto& cards = box.active_cards;
+    // https://wizardofodds.com/games/blackjack/strategy/european/
+    const auto w = card_game::get_weight(cards);
+    const auto hard = card_game::is_hard(cards);
+    check(9 <= w && w <= 11 && hard, "player may only double on hard totals of 9-11");
+    check_deposit(get_session(state_itr->ses_id).deposit, state_itr->staked_sum() + box.ante, bet_itr->side_bets_sum());
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        row.boxes[row.active_box].ante *= 2;
+    });
+    return true;
+}
+
 void blackjack::on_random(uint64_t ses_id, checksum256 rand) {
+    static constexpr random_handler handlers[fsm::states_count] = {
+        nullptr,
+        nullptr,
+        &blackjack::on_hit_random,
+        &blackjack::on_stand_random,
+        &blackjack::on_double_down_random,
+        &blackjack::on_split_random,
+        &blackjack::on_deal_cards_random,
+        nullptr,
+    };
+
     const auto state_itr = state.require_find(ses_id, "invalid ses_id");
     const auto bet_itr = bet.require_find(ses_id, "invalid ses_id");
-    const auto ante = bet_itr->ante;
-
-    switch (state_itr->state) {
-        case game_state::deal_cards: {
-            eosio::print("dealing cards\n");
-            auto [res, player_cards, dealer_cards] = deal_initial_cards(state_itr, rand);
-            asset side_bets_win;
-            state.modify(state_itr, get_self(), [&, player_cards = player_cards, dealer_card = dealer_cards[0]](auto& row) {
-                row.pair_win = get_pair_win(player_cards, bet_itr->pair);
-                row.first_three_win = get_first_three_win(player_cards, dealer_card, bet_itr->first_three);
-                side_bets_win = row.pair_win + row.first_three_win;
-            });
-            eosio::print_f("side bets: pair_win=%s first_three=%s", state_itr->pair_win, state_itr->first_three_win);
-            if (res == outcome::draw) {
-                // both players have a blackjack
-                eosio::print("both dealer and player get a blackjack\n");
-                end_game(ses_id, side_bets_win, std::move(dealer_cards), std::move(player_cards));
-                return;
-            } else if (res == outcome::player) {
-                // player has a blackjack. It pays 3:2
-                eosio::print_f("player gets a blackjack, player: {%, %}, dealer: {%, %}\n",
-                                player_cards[0].to_string(), player_cards[1].to_string(),
-                                dealer_cards[0].to_string(), dealer_cards[1].to_string());
-                end_game(ses_id, 3 * ante / 2 + side_bets_win, std::move(dealer_cards), std::move(player_cards));
-                return;
-            }
-            require_action(action::play, true);
-            update_state(state_itr, game_state::require_play);
-            update_max_win(ses_id, -4 * bet_itr->pair - 25 * bet_itr->first_three + side_bets_win);
-            send_game_message(std::vector<param_t>{player_cards[0].get_value(), player_cards[1].get_value(), dealer_cards[0].get_value()});
-            break;
-        }
-        case game_state::deal_one_card: {
-            eosio::print("player hits");
-            auto [res, player_card, deck] = deal_a_card(state_itr, rand);
-            if (res == outcome::dealer || card_game::get_weight(state_itr->active_cards) == 21) {
-                if (!state_itr->has_split() || state_itr->second_round) {
-                    auto [win, dealer_cards] = compare_and_finish(state_itr, ante, rand, std::move(deck));
-                    end_game(ses_id, win, std::move(dealer_cards), {player_card});
-                    return;
-                } else {
-                    finish_first_round(state_itr);
-                }
-            }
-            require_action(action::play, true);
-            update_state(state_itr, game_state::require_play);
-            // if player has 2 cards and hasn't split it means it's his first action in the game
-            if (!state_itr->has_split() && state_itr->active_cards.size() == 2) {
-                // since he cannot split anymore his max win is 4 * ante - 3 * ante = ante
-                update_max_win(ses_id, -3 * ante);
-            }
-            send_game_message(std::vector<param_t>{player_card.get_value()});
-            break;
+    check(fsm::awaits_random(state_itr->state), "invalid game state");
+    (this->*handlers[state_itr->state])(state_itr, bet_itr, rand);
+}
+
+void blackjack::on_deal_cards_random(state_table::const_iterator state_itr, bet_table::const_iterator bet_itr, const checksum256& rand) {
+    const auto ses_id = state_itr->ses_id;
+    LOG_DEBUG("dealing cards\n");
+    auto [player_cards, dealer_cards] = deal_initial_cards(state_itr, rand);
+    asset side_bets_win = zero_asset;
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        for (size_t i = 0; i < row.boxes.size(); i++) {
+            auto& box = row.boxes[i];
+            const auto& box_bet = bet_itr->boxes[i];
+            box.pair_win = get_pair_win(box.active_cards, box_bet.pair);
+            box.first_three_win = get_first_three_win(box.active_cards, row.dealer_card, box_bet.first_three);
+            side_bets_win += box.pair_win + box.first_three_win;
         }
-        case game_state::double_down: {
-            eosio::print("player doubles down");
-            auto [res, player_card, deck] = deal_a_card(state_itr, rand);
-            check(res == outcome::carry_on, "invariant check failed: player cannot bust when doubling");
-            if (!state_itr->has_split() || state_itr->second_round) {
-                auto [win, dealer_cards] = compare_and_finish(state_itr, ante * 2, rand, std::move(deck));
-                end_game(ses_id, win, std::move(dealer_cards), {player_card});
-                return;
-            } else {
-                state.modify(state_itr, get_self(), [&](auto& row) {
-                    row.first_round_ante *= 2;
-                });
-                finish_first_round(state_itr);
+    });
+    LOG_INFO("side bets win: %\n", side_bets_win);
+    if (dealer_cards.size() == 2) {
+        // player has a blackjack in every box. It pays 3:2 unless the dealer has a blackjack too
+        asset win = side_bets_win;
+        if (card_game::get_weight(dealer_cards) == 21) {
+            LOG_INFO("both dealer and player get a blackjack\n");
+        } else {
+            LOG_INFO("player gets a blackjack, dealer: {%, %}\n",
+                            dealer_cards[0].to_string(), dealer_cards[1].to_string());
+            for (const auto& box : state_itr->boxes) {
+                win += 3 * box.ante / 2;
             }
-            send_game_message(std::vector<param_t>{player_card.get_value()});
-            update_state(state_itr, game_state::require_play);
-            require_action(action::play, true);
-            break;
         }
-        case game_state::stand: {
-            auto [win, dealer_cards] = compare_and_finish(state_itr, ante, rand, prepare_deck(state_itr, rand));
-            end_game(ses_id, win, std::move(dealer_cards), {});
-            break;
+        end_game(ses_id, win, std::move(dealer_cards), std::move(player_cards));
+        return;
+    }
+    require_action(action::play, true);
+    update_state(state_itr, fsm::event::random);
+    update_max_win(ses_id);
+    send_game_message(encode_cards(dealer_cards, player_cards));
+}
+
+void blackjack::on_hit_random(state_table::const_iterator state_itr, [[maybe_unused]] bet_table::const_iterator bet_itr,
+                              const checksum256& rand) {
+    LOG_DEBUG("player hits\n");
+    auto [res, player_card, deck] = deal_a_card(state_itr, rand);
+    if (res == outcome::dealer || card_game::get_weight(state_itr->active().active_cards) == 21) {
+        if (!next_hand(state_itr)) {
+            auto [win, dealer_cards] = compare_and_finish(state_itr, rand, std::move(deck));
+            end_game(state_itr->ses_id, win, std::move(dealer_cards), {player_card});
+            return;
         }
-        case game_state::split: {
-            eosio::print("player splits\n");
-            // take 2 cards from the deck and send them to frontend
-            auto deck = prepare_deck(state_itr, rand);
-            const auto ncard1 = card(deck[0]), ncard2 = card(deck[1]);
-            const bool aces = state_itr->active_cards[0].get_rank() == card_game::rank::ACE;
-            deck.erase(deck.begin(), deck.begin() + 2);
-            state.modify(state_itr, get_self(), [&](auto& row) {
-                row.active_cards.push_back(ncard1);
-                row.split_cards.push_back(ncard2);
-            });
-            if (!aces) {
-                if (card_game::get_weight(state_itr->active_cards) == 21) {
-                    finish_first_round(state_itr);
-                    if (card_game::get_weight(state_itr->active_cards) == 21) {
-                        auto [win, dealer_cards] = compare_and_finish(state_itr, ante, rand, std::move(deck));
-                        end_game(ses_id, win, std::move(dealer_cards), {ncard1, ncard2});
-                        return;
-                    }
-                }
-                send_game_message(std::vector<param_t>{
-                    ncard1.get_value(),
-                    ncard2.get_value()
-                });
-                update_state(state_itr, game_state::require_play);
-                require_action(action::play, true);
-            } else {
-                // In most casinos the player is only allowed to draw one card on each split ace
-                // As a general rule, a ten on a split ace (or vice versa) is not considered a natural blackjack and does not get any bonus
-                auto [win, dealer_cards] = compare_and_finish(state_itr, ante, rand, std::move(deck));
-                end_game(ses_id, win, std::move(dealer_cards), {ncard1, ncard2});
-            }
-            break;
+    }
+    require_action(action::play, true);
+    update_state(state_itr, fsm::event::random);
+    update_max_win(state_itr->ses_id);
+    send_game_message(encode_cards({}, {player_card}));
+}
+
+void blackjack::on_double_down_random(state_table::const_iterator state_itr, [[maybe_unused]] bet_table::const_iterator bet_itr,
+                                      const checksum256& rand) {
+    LOG_DEBUG("player doubles down\n");
+    auto [res, player_card, deck] = deal_a_card(state_itr, rand);
+    check(res == outcome::carry_on, "invariant check failed: player cannot bust when doubling");
+    if (!next_hand(state_itr)) {
+        auto [win, dealer_cards] = compare_and_finish(state_itr, rand, std::move(deck));
+        end_game(state_itr->ses_id, win, std::move(dealer_cards), {player_card});
+        return;
+    }
+    send_game_message(encode_cards({}, {player_card}));
+    update_state(state_itr, fsm::event::random);
+    update_max_win(state_itr->ses_id);
+    require_action(action::play, true);
+}
+
+void blackjack::on_stand_random(state_table::const_iterator state_itr, [[maybe_unused]] bet_table::const_iterator bet_itr,
+                                const checksum256& rand) {
+    auto [win, dealer_cards] = compare_and_finish(state_itr, rand, prepare_deck(state_itr, rand));
+    end_game(state_itr->ses_id, win, std::move(dealer_cards), {});
+}
+
+void blackjack::on_split_random(state_table::const_iterator state_itr, [[maybe_unused]] bet_table::const_iterator bet_itr,
+                                const checksum256& rand) {
+    LOG_DEBUG("player splits\n");
+    // take 2 cards from the deck and send them to frontend
+    auto deck = prepare_deck(state_itr, rand);
+    const auto ncard1 = deck.take(), ncard2 = deck.take();
+    const bool aces = state_itr->active().active_cards[0].get_rank() == card_game::rank::ACE;
+    state.modify(state_itr, get_self(), [&](auto& row) {
+        auto& box = row.boxes[row.active_box];
+        box.active_cards.push_back(ncard1);
+        box.split_cards.push_back(ncard2);
+    });
+    take_from_casino_shoe(state_itr->ses_id, {ncard1, ncard2});
+    // In most casinos the player is only allowed to draw one card on each split ace
+    // As a general rule, a ten on a split ace (or vice versa) is not considered a natural blackjack and does not get any bonus
+    bool box_finished = aces;
+    if (!aces && card_game::get_weight(state_itr->active().active_cards) == 21) {
+        finish_first_round(state_itr);
+        box_finished = card_game::get_weight(state_itr->active().active_cards) == 21;
+    }
+    if (box_finished && !next_box(state_itr)) {
+        auto [win, dealer_cards] = compare_and_finish(state_itr, rand, std::move(deck));
+        end_game(state_itr->ses_id, win, std::move(dealer_cards), {ncard1, ncard2});
+        return;
+    }
+    send_game_message(encode_cards({}, {ncard1, ncard2}));
+    update_state(state_itr, fsm::event::random);
+    update_max_win(state_itr->ses_id);
+    require_action(action::play, true);
+}
+
+void blackjack::evhint(uint64_t ses_id) {
+    static const char* names[] = {"hit", "stand", "split", "double_down"};
+    const auto state_itr = state.require_find(ses_id, "invalid ses_id");
+    check(state_itr->state == game_state::require_play, "game state should be require_play");
+    const auto& box = state_itr->active();
+    const auto evs = hint::get(box.active_cards, state_itr->dealer_card, !box.has_split());
+    eosio::print("{");
+    for (size_t i = 0; i < evs.size(); i++) {
+        eosio::print(i ? ",\"" : "\"", names[i], "\":");
+        if (evs[i] == hint::unavailable) {
+            eosio::print("null");
+        } else {
+            eosio::print(int64_t(evs[i]));
         }
-        default:
-            check(0, "invalid game state");
     }
+    eosio::print("}");
 }
 
 void blackjack::on_finish(uint64_t ses_id) {
     const auto state_itr = state.find(ses_id);
     if (state_itr != state.end()) {
+        return_to_casino_shoe(*state_itr);
         state.erase(state_itr);
     }
     const auto bet_itr = bet.find(ses_id);
     if (bet_itr != bet.end()) {
         bet.erase(bet_itr);
     }
+#ifdef IS_DEBUG
+    debug_shoe_table shoes(_self, _self.value);
+    const auto shoe_itr = shoes.find(ses_id);
+    if (shoe_itr != shoes.end()) {
+        shoes.erase(shoe_itr);
+    }
+#endif
+}
+
+void blackjack::setshuffle(uint64_t casino_id, bool enabled) {
+    require_auth(get_self());
+    shuffle_opt_table opted_in(_self, _self.value);
+    const auto itr = opted_in.find(casino_id);
+    if (enabled && itr == opted_in.end()) {
+        opted_in.emplace(get_self(), [&](auto& row) {
+            row.casino_id = casino_id;
+        });
+    } else if (!enabled && itr != opted_in.end()) {
+        opted_in.erase(itr);
+    }
 }
 
 #ifndef IS_DEBUG
-GAME_CONTRACT(blackjack)
+GAME_CONTRACT_CUSTOM_ACTIONS(blackjack, (evhint)(setshuffle))
 #else
-GAME_CONTRACT_CUSTOM_ACTIONS(blackjack, (pushlabels))
+GAME_CONTRACT_CUSTOM_ACTIONS(blackjack, (evhint)(setshuffle)(pushshoe))
 #endif
 } // namespace blackjack
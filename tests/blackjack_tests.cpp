@@ -1,13 +1,22 @@
 #define TEST 1
 
+#include <cmath>
 #include <iostream>
+#include <random>
 
 #include <game_tester/game_tester.hpp>
 #include <game_tester/strategy.hpp>
+#include <fc/io/json.hpp>
 #include <fc/reflect/reflect.hpp>
 
 #include "contracts.hpp"
 #include <blackjack/card.hpp>
+#include <blackjack/draw.hpp>
+#include <blackjack/hint.hpp>
+#include <blackjack/message.hpp>
+#include <blackjack/state_machine.hpp>
+#include <rtp/estimator.hpp>
+#include <strategy/strategy.hpp>
 
 namespace testing {
 
@@ -27,7 +36,8 @@ public:
     static constexpr uint64_t default_first_three_max_bet = 1000'0000; // 1k
     static constexpr uint64_t default_max_payout = 100000'0000; // 100k BET
 public:
-    blackjack_tester() {
+    // the extra params follow the default ones, e.g. the optional continuous shuffle
+    explicit blackjack_tester(const game_params_type& extra_params = {}) {
         create_account(game_name);
 
         game_params_type game_params = {
@@ -37,6 +47,7 @@ public:
             {3, default_pair_max_bet},
             {4, default_first_three_max_bet}
         };
+        game_params.insert(game_params.end(), extra_params.begin(), extra_params.end());
         deploy_game<blackjack_game>(game_name, game_params);
         create_player(player_name);
         link_game(player_name, game_name);
@@ -52,6 +63,14 @@ public:
         });
     }
 
+    void bet_boxes(uint64_t ses_id, const std::vector<asset>& antes) {
+        std::vector<param_t> params;
+        for (const auto& ante : antes) {
+            params.insert(params.end(), {static_cast<uint64_t>(ante.get_amount()), 0, 0});
+        }
+        game_action(game_name, ses_id, 0, params);
+    }
+
     void hit(uint64_t ses_id) {
         game_action(game_name, ses_id, 1, {0});
     }
@@ -73,7 +92,7 @@ public:
     }
 
     asset get_ante(uint64_t ses_id) {
-        return get_bet(ses_id)["ante"].as<asset>();
+        return get_bet(ses_id)["boxes"][get_state(ses_id)["active_box"].as<uint32_t>()]["ante"].as<asset>();
     }
 
     fc::variant get_bet(uint64_t ses_id) {
@@ -88,61 +107,116 @@ public:
                             : abi_ser[game_name].binary_to_variant("state_row", data, abi_serializer_max_time);
     }
 
+    fc::variant get_stats(uint64_t shard = 0) {
+        vector<char> data = get_row_by_account(game_name, game_name, N(stats), shard);
+        return data.empty() ? fc::variant()
+                            : abi_ser[game_name].binary_to_variant("stats_row", data, abi_serializer_max_time);
+    }
+
+    // the casino's continuous shuffling machine, empty if it's never been written
+    vector<char> get_casino_shoe_row() {
+        return get_row_by_account(game_name, name(casino_id), N(shoe), N(shoe));
+    }
+
+    action_result set_shuffle(bool enabled, name actor = game_name) {
+        return push_action(game_name, N(setshuffle), {actor, N(active)},
+                           mvo()("casino_id", casino_id)("enabled", enabled));
+    }
+
+    // a game of a single box that stands on whatever it's dealt
+    void play_standing() {
+        const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("10.0000"));
+        bet(ses_id, STRSYM("10.0000"));
+        signidice(game_name, ses_id);
+        while (!get_state(ses_id).is_null()) {
+            stand(ses_id);
+            signidice(game_name, ses_id);
+        }
+    }
+
+    fc::variant get_ev_hint(uint64_t ses_id) {
+        const auto trace = base_tester::push_action(game_name, N(evhint), player_name, mvo()("ses_id", ses_id));
+        return fc::json::from_string(trace->action_traces.front().console);
+    }
+
+    fc::variant get_active_box(uint64_t ses_id) {
+        const auto state = get_state(ses_id);
+        return state["boxes"][state["active_box"].as<uint32_t>()];
+    }
+
+    // scripts the shoe: the next cards dealt are `cards` in order, then the usual random draws
     void push_cards(uint64_t ses_id, const cards_t& cards) {
-        card_game::labels_t labels(cards.size());
-        for (int i = 0; i < cards.size(); i++) {
-            labels[i] = cards[i].to_string();
+        fc::variants ids;
+        for (const auto& c : cards) {
+            ids.emplace_back(c.get_value());
         }
         BOOST_REQUIRE_EQUAL(
             push_action(
                 game_name,
-                N(pushlabels),
+                N(pushshoe),
                 {game_name, N(active)},
                 mvo()
                     ("ses_id", ses_id)
-                    ("labels", labels)
+                    ("cards", ids)
             ),
             success()
         );
     }
 
+    // plays a whole game from a single scripted shoe, decisions are
+    // 'H' hit, 'S' stand, 'D' double down, 'P' split
+    void play_scripted(uint64_t ses_id, const cards_t& shoe, const std::string& decisions) {
+        push_cards(ses_id, shoe);
+        signidice(game_name, ses_id);
+        for (const char d : decisions) {
+            switch (d) {
+                case 'H': hit(ses_id); break;
+                case 'S': stand(ses_id); break;
+                case 'D': double_down(ses_id); break;
+                case 'P': split(ses_id); break;
+                default: BOOST_FAIL("unknown decision " << d);
+            }
+            // a stand that moves play to the next hand doesn't require a random
+            const auto state = get_state(ses_id);
+            if (state.is_null() || state["state"].as<uint16_t>() == blackjack::fsm::require_play) {
+                continue;
+            }
+            signidice(game_name, ses_id);
+        }
+        BOOST_REQUIRE(get_state(ses_id).is_null());
+    }
+
+    std::pair<cards_t, cards_t> decode_message(const bytes& msg) {
+        if (msg.empty()) {
+            return {{}, {}};
+        }
+        auto reader = blackjack::message::reader::from_serialized(msg.data(), msg.size());
+        BOOST_REQUIRE(reader.valid());
+        return reader.decode();
+    }
+
+    // player's cards followed by dealer's cards
     card_game::cards_t get_game_message_cards() {
         cards_t result;
         if (const std::optional<std::vector<fc::variant>> msg_events = get_events(events_id::game_message); msg_events != std::nullopt){
             const auto& event = msg_events->back();
-            const auto values = fc::raw::unpack<std::vector<uint64_t>>(event["msg"].as<bytes>());
-            result.resize(values.size());
-            for (int i = 0; i < values.size(); i++) {
-                result[i] = card(values[i]);
-            }
+            auto [player_cards, dealer_cards] = decode_message(event["msg"].as<bytes>());
+            result = std::move(player_cards);
+            result.insert(result.end(), dealer_cards.begin(), dealer_cards.end());
         }
         return result;
     }
 
-    std::vector<param_t> get_game_finish_message() {
+    bytes get_game_finish_message() {
         if (const std::optional<std::vector<fc::variant>> msg_events = get_events(events_id::game_finished); msg_events != std::nullopt){
             const auto& event = msg_events->back();
-            return fc::raw::unpack<std::vector<uint64_t>>(event["msg"].as<bytes>());
+            return event["msg"].as<bytes>();
         }
         return {};
     }
 
-    std::pair<cards_t, cards_t> decode_game_finish_message(const std::vector<param_t>& msg) {
-        if (msg.empty()) {
-            return {{}, {}};
-        }
-        BOOST_CHECK(msg.size() > msg[0] && msg.size() == 2 + msg[0] + msg[msg[0] + 1]);
-        cards_t player_cards, dealer_cards;
-        player_cards.reserve(msg[0]);
-        int i = 1;
-        while (i <= msg[0]) {
-            player_cards.push_back(card(msg[i++]));
-        }
-        dealer_cards.reserve(msg[i++]);
-        while (i < msg.size()) {
-            dealer_cards.push_back(card(msg[i++]));
-        }
-        return {player_cards, dealer_cards};
+    std::pair<cards_t, cards_t> decode_game_finish_message(const bytes& msg) {
+        return decode_message(msg);
     }
 
     cards_t get_player_finish_cards() {
@@ -249,71 +323,54 @@ BOOST_FIXTURE_TEST_CASE(invalid_action, blackjack_tester) try {
     );
 } FC_LOG_AND_RETHROW()
 
-#ifdef IS_DEBUG
-
-char hard_decision[10][10] = {
-    {'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H'},
-    {'H', 'D', 'D', 'D', 'D', 'H', 'H', 'H', 'H', 'H'},
-    {'D', 'D', 'D', 'D', 'D', 'D', 'D', 'D', 'H', 'H'},
-    {'D', 'D', 'D', 'D', 'D', 'D', 'D', 'D', 'H', 'H'},
-    {'H', 'H', 'S', 'S', 'S', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S'}
-};
-
-char soft_decision[3][10] = {
-    {'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'S', 'S', 'H', 'H', 'H'},
-    {'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S'}
-};
-
-char pair_decision[10][10] = {
-    {'P', 'P', 'P', 'P', 'P', 'P', 'H', 'H', 'H', 'H'},
-    {'P', 'P', 'P', 'P', 'P', 'P', 'H', 'H', 'H', 'H'},
-    {'H', 'H', 'H', 'P', 'P', 'H', 'H', 'H', 'H', 'H'},
-    {'D', 'D', 'D', 'D', 'D', 'D', 'D', 'D', 'H', 'H'},
-    {'P', 'P', 'P', 'P', 'P', 'H', 'H', 'H', 'H', 'H'},
-    {'P', 'P', 'P', 'P', 'P', 'P', 'H', 'H', 'H', 'H'},
-    {'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P', 'H', 'H'},
-    {'P', 'P', 'P', 'P', 'P', 'S', 'P', 'P', 'S', 'S'},
-    {'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S', 'S'},
-    {'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P', 'P', 'H'}
-};
-
-char get_decision(int player_sum, int dealer_rank, bool hard, bool pair, bool aces) {
-    char d;
-    if (pair) {
-        if (aces) {
-            // pair of aces (1 + 11)
-            d = pair_decision[9][dealer_rank];
-        } else {
-            d = pair_decision[player_sum / 2 - 2][dealer_rank];
-        }
-    } else if (hard) {
-        BOOST_CHECK(5 <= player_sum);
-        if (player_sum <= 8) {
-            d = hard_decision[0][dealer_rank];
-        } else if (player_sum <= 16) {
-            d = hard_decision[player_sum - 8][dealer_rank];
+BOOST_FIXTURE_TEST_CASE(max_win_never_under_reserves, blackjack_tester) try {
+    std::mt19937 rng(2020);
+    for (int i = 0; i < 300; i++) {
+        const auto before_balance = get_balance(player_name);
+        const int boxes = 1 + rng() % 3;
+        uint64_t ses_id;
+        if (boxes == 1) {
+            const auto pair = rng() % 2 ? STRSYM("1.0000") : zero_asset;
+            const auto first_three = rng() % 2 ? STRSYM("1.0000") : zero_asset;
+            ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("10.0000") + pair + first_three);
+            bet(ses_id, STRSYM("10.0000"), pair, first_three);
         } else {
-            d = hard_decision[9][dealer_rank];
+            ses_id = new_game_session(game_name, player_name, casino_id, asset(boxes * 10'0000, symbol(CORE_SYM)));
+            bet_boxes(ses_id, std::vector<asset>(boxes, STRSYM("10.0000")));
         }
-    } else {
-        // A (11) + 2
-        BOOST_CHECK(13 <= player_sum);
-        if (player_sum <= 17) {
-            d = soft_decision[0][dealer_rank];
-        } else if (player_sum == 18) {
-            d = soft_decision[1][dealer_rank];
-        } else {
-            d = soft_decision[2][dealer_rank];
+        asset min_reserved = get_state(ses_id)["max_player_win"].as<asset>();
+        signidice(game_name, ses_id);
+        while (!get_state(ses_id).is_null()) {
+            min_reserved = std::min(min_reserved, get_state(ses_id)["max_player_win"].as<asset>());
+            const auto box = get_active_box(ses_id);
+            const auto cards = box["active_cards"].as<cards_t>();
+            const auto w = get_weight(cards);
+            std::vector<char> decisions{'H', 'S'};
+            if (cards.size() == 2 && 9 <= w && w <= 11 && card_game::is_hard(cards)) {
+                decisions.push_back('D');
+            }
+            if (cards.size() == 2 && box["split_cards"].as<cards_t>().empty() && get_weight(cards[0]) == get_weight(cards[1])) {
+                decisions.push_back('P');
+            }
+            const char d = decisions[rng() % decisions.size()];
+            switch (d) {
+                case 'H': hit(ses_id); break;
+                case 'S': stand(ses_id); break;
+                case 'D': double_down(ses_id); break;
+                case 'P': split(ses_id); break;
+            }
+            min_reserved = std::min(min_reserved, get_state(ses_id)["max_player_win"].as<asset>());
+            // player moves to the next hand without a random
+            if (d == 'S' && get_state(ses_id)["state"].as<uint16_t>() == 1) {
+                continue;
+            }
+            signidice(game_name, ses_id);
         }
+        BOOST_REQUIRE_LE(get_balance(player_name) - before_balance, min_reserved);
     }
-    return d;
-}
+} FC_LOG_AND_RETHROW()
+
+#ifdef IS_DEBUG
 
 const int ROUNDS_PER_BATCH = 1000;
 
@@ -336,46 +393,35 @@ std::pair<asset, asset> get_batch_result() {
             // no blackjack at the begining
             BOOST_TEST_MESSAGE("Initial cards dealt: " << initial_cards);
             const auto dealer_card = initial_cards.back();
-            const auto dealer_shifted_rank = (dealer_card.get_rank() == card_game::rank::ACE ? 11 : card_game::get_weight(dealer_card)) - 2;
             fc::variant state;
             bool game_finished = false;
             while (!game_finished) {
-                const auto& state = t.get_state(ses_id);
+                const auto& state = t.get_active_box(ses_id);
                 const bool has_split = !state["split_cards"].as<cards_t>().empty();
                 auto cards = state["active_cards"].as<cards_t>();
                 BOOST_TEST_MESSAGE("Player's cards: " << cards);
-                const bool pair = (cards.size() == 2 && cards[0].get_rank() == cards[1].get_rank());
-                const char d = get_decision(card_game::get_weight(cards), dealer_shifted_rank, card_game::is_hard(cards), pair, cards[0].get_rank() == card_game::rank::ACE);
-                BOOST_TEST_MESSAGE("Decision: " << d << " sum: " << card_game::get_weight(cards));
+                const auto d = blackjack::strategy::decide(cards, dealer_card, !has_split);
+                BOOST_TEST_MESSAGE("Decision: " << int(d) << " sum: " << card_game::get_weight(cards));
                 switch(d) {
-                case 'H':
+                case blackjack::strategy::hit:
                     t.hit(ses_id);
                     break;
-                case 'S':
+                case blackjack::strategy::stand:
                     t.stand(ses_id);
                     break;
-                case 'D':
-                    if (cards.size() == 2) {
-                        t.double_down(ses_id);
-                        all_bets_sum += bet_amount;
-                    } else {
-                        // otherwise just hit
-                        t.hit(ses_id);
-                    }
+                case blackjack::strategy::double_down:
+                    t.double_down(ses_id);
+                    all_bets_sum += bet_amount;
                     break;
-                case 'P':
-                    if (!has_split) {
-                        t.split(ses_id);
-                        all_bets_sum += bet_amount;
-                    } else {
-                        t.hit(ses_id);
-                    }
+                case blackjack::strategy::split:
+                    t.split(ses_id);
+                    all_bets_sum += bet_amount;
                     break;
                 default:
                     throw std::logic_error("unknown decision");
                 }
 
-                if (d == 'S' && has_split && !state["second_round"].as<bool>()) {
+                if (d == blackjack::strategy::stand && has_split && !state["second_round"].as<bool>()) {
                     continue;
                 }
                 t.signidice(t.game_name, ses_id);
@@ -439,38 +485,174 @@ std::pair<asset, asset> get_side_bet_batch_result(asset pair, asset first_three)
     return std::make_pair(t.get_balance(t.player_name) - before_batch_balance - ante_win_sum, all_side_bets_sum);
 }
 
-inline double to_double(const asset& value) {
-    return double(value.get_amount()) / value.precision();
-}
-
 typedef std::function<std::pair<asset, asset>()> batch_runner_t;
 
-double get_rtp(batch_runner_t&& batch_runner_fn) {
-    const int rounds = 1'000'000;
-    const int batches = rounds / ROUNDS_PER_BATCH;
-    asset returned = STRSYM("0.0000");
-    asset all_bets_sum = STRSYM("0.0000");
-    for (int i = 0; i < batches; i++) {
+// plays batches until the 95% confidence half-width of the RTP reaches target_half_width,
+// or max_rounds are played; batches are the samples of a ratio estimator
+double get_rtp(batch_runner_t&& batch_runner_fn, double target_half_width = 0, int max_rounds = 1'000'000) {
+    const int min_batches = 10;
+    const int max_batches = max_rounds / ROUNDS_PER_BATCH;
+    blackjack::rtp::ratio_estimator estimator;
+    for (int i = 0; i < max_batches; i++) {
         const auto [r, b] = batch_runner_fn();
-        returned += r;
-        all_bets_sum += b;
-        std::cerr << "Batch #" << i + 1 << " completed, rtp: " << to_double(returned) / to_double(all_bets_sum) + 1 << "\n";
+        estimator.add({(r + b).get_amount(), b.get_amount()});
+        std::cerr << "Batch #" << i + 1 << " completed, rtp: " << estimator.value() << " +- " << estimator.half_width() << "\n";
+        if (i + 1 >= min_batches && estimator.half_width() <= target_half_width) {
+            break;
+        }
     }
-    return to_double(returned) / to_double(all_bets_sum) + 1;
+    BOOST_TEST_MESSAGE("RTP " << estimator.value() << " +- " << estimator.half_width() << " after " << estimator.size() * ROUNDS_PER_BATCH << " rounds");
+    return estimator.value();
 }
 
 BOOST_AUTO_TEST_CASE(rtp_maingame_test, *boost::unit_test::disabled()) try {
-    BOOST_TEST(get_rtp(get_batch_result) == 0.993, boost::test_tools::tolerance(0.001));
+    BOOST_TEST(get_rtp(get_batch_result, 0.0005) == 0.993, boost::test_tools::tolerance(0.001));
 } FC_LOG_AND_RETHROW()
 
 BOOST_AUTO_TEST_CASE(rtp_pair_test, *boost::unit_test::disabled()) try {
-    auto lambda = [](){ return get_side_bet_batch_result(STRSYM("1.0000"), STRSYM("0.0000")); };
-    BOOST_TEST(get_rtp(lambda) == 0.96, boost::test_tools::tolerance(0.05));
+    auto lambda = []() { return get_side_bet_batch_result(STRSYM("1.0000"), STRSYM("0.0000")); };
+    BOOST_TEST(get_rtp(lambda, 0.01) == 0.96, boost::test_tools::tolerance(0.05));
 } FC_LOG_AND_RETHROW()
 
 BOOST_AUTO_TEST_CASE(rtp_first_three_test, *boost::unit_test::disabled()) try {
-    auto lambda = [](){ return get_side_bet_batch_result(STRSYM("0.0000"), STRSYM("1.0000")); };
-    BOOST_TEST(get_rtp(lambda) == 0.963, boost::test_tools::tolerance(0.05));
+    auto lambda = []() { return get_side_bet_batch_result(STRSYM("0.0000"), STRSYM("1.0000")); };
+    BOOST_TEST(get_rtp(lambda, 0.01) == 0.963, boost::test_tools::tolerance(0.05));
+} FC_LOG_AND_RETHROW()
+
+// ----------------------------
+// unbiased card draws from a random, see draw.hpp
+
+std::array<uint8_t, 32> random_bytes(std::mt19937_64& rng) {
+    std::array<uint8_t, 32> bytes;
+    for (auto& b : bytes) {
+        b = rng();
+    }
+    return bytes;
+}
+
+// a draw of a random from rng with PRNG refills from rng as well
+auto make_draw(std::mt19937_64& rng) {
+    return blackjack::index_draw(random_bytes(rng), [&rng] { return rng(); });
+}
+
+double chi_square(const std::vector<uint64_t>& counts, const std::vector<double>& expected) {
+    double chi2 = 0;
+    for (size_t i = 0; i < counts.size(); i++) {
+        chi2 += (counts[i] - expected[i]) * (counts[i] - expected[i]) / expected[i];
+    }
+    return chi2;
+}
+
+// the chi-square statistic of df degrees of freedom exceeds it with a probability of about 1e-6 (Wilson-Hilferty)
+double chi_square_bound(int df) {
+    const double z = 4.75, v = 2. / (9 * df);
+    return df * std::pow(1 - v + z * std::sqrt(v), 3);
+}
+
+BOOST_AUTO_TEST_CASE(draw_index_uniform) try {
+    std::mt19937_64 rng(1);
+    for (const uint32_t n : {416, 409, 52, 13, 3}) {
+        std::vector<uint64_t> counts(n);
+        const int randoms = 100'000;
+        // 20 draws of a random take its 8 words and 6 PRNG refills
+        for (int i = 0; i < randoms; i++) {
+            auto draw = make_draw(rng);
+            for (int j = 0; j < 20; j++) {
+                const auto idx = draw(n);
+                BOOST_REQUIRE_LT(idx, n);
+                counts[idx]++;
+            }
+        }
+        const auto chi2 = chi_square(counts, std::vector<double>(n, 20. * randoms / n));
+        BOOST_TEST_MESSAGE("n " << n << ": chi2 " << chi2 << ", bound " << chi_square_bound(n - 1));
+        BOOST_TEST(chi2 < chi_square_bound(n - 1));
+    }
+} FC_LOG_AND_RETHROW()
+
+// 9 cards of a deal out of the full 8 deck shoe, in the order a deal draws them: every position is uniform
+// over the 52 card values and the ranks of any two positions are as for a well shuffled shoe
+BOOST_AUTO_TEST_CASE(draw_cards_uniform_over_shoe) try {
+    const int positions = 9, randoms = 400'000;
+    std::mt19937_64 rng(2);
+    std::vector<std::vector<uint64_t>> values(positions, std::vector<uint64_t>(52));
+    std::vector<std::vector<std::vector<uint64_t>>> ranks(positions,
+        std::vector<std::vector<uint64_t>>(positions, std::vector<uint64_t>(13 * 13)));
+    for (int i = 0; i < randoms; i++) {
+        std::array<uint8_t, 52> shoe;
+        shoe.fill(8);
+        int left = 52 * 8;
+        auto draw = make_draw(rng);
+        uint8_t dealt[positions];
+        for (int p = 0; p < positions; p++) {
+            dealt[p] = blackjack::take_card(shoe, draw(left--));
+            values[p][dealt[p]]++;
+        }
+        BOOST_REQUIRE_EQUAL(draw.refills(), 1);
+        for (int p = 0; p < positions; p++) {
+            for (int q = p + 1; q < positions; q++) {
+                ranks[p][q][dealt[p] / 4 * 13 + dealt[q] / 4]++;
+            }
+        }
+    }
+    // 32 cards of every rank out of 416
+    std::vector<double> pair_expected(13 * 13);
+    for (int a = 0; a < 13; a++) {
+        for (int b = 0; b < 13; b++) {
+            pair_expected[a * 13 + b] = randoms * 32. / 416 * (32 - (a == b)) / 415;
+        }
+    }
+    for (int p = 0; p < positions; p++) {
+        BOOST_TEST(chi_square(values[p], std::vector<double>(52, randoms / 52.)) < chi_square_bound(51));
+        for (int q = p + 1; q < positions; q++) {
+            BOOST_TEST(chi_square(ranks[p][q], pair_expected) < chi_square_bound(13 * 13 - 1));
+        }
+    }
+} FC_LOG_AND_RETHROW()
+
+BOOST_AUTO_TEST_CASE(draw_refills_only_when_random_is_used_up) try {
+    std::mt19937_64 rng(3);
+    auto draw = make_draw(rng);
+    for (int i = 0; i < 8; i++) {
+        draw(416);
+    }
+    BOOST_TEST(draw.refills() == 0);
+    draw(416);
+    draw(416);
+    BOOST_TEST(draw.refills() == 1);
+    draw(416);
+    BOOST_TEST(draw.refills() == 2);
+} FC_LOG_AND_RETHROW()
+
+BOOST_AUTO_TEST_CASE(draw_rejects_biased_words) try {
+    // zero words fall in the rejected 2^32 mod 3 = 1 values of x * 3, so all 8 words of the random are rejected
+    // and the draw takes 2^31 of the PRNG, which maps to 2^31 * 3 / 2^32 = 1
+    int refills = 0;
+    blackjack::index_draw draw(std::array<uint8_t, 32>{}, [&] {
+        refills++;
+        return uint64_t(1) << 63;
+    });
+    BOOST_TEST(draw(3) == 1);
+    BOOST_TEST(draw.refills() == 1);
+    BOOST_TEST(refills == 1);
+    // no rejection for a power of 2
+    blackjack::index_draw exact(std::array<uint8_t, 32>{}, [] { return uint64_t(0); });
+    BOOST_TEST(exact(4) == 0);
+    BOOST_TEST(exact.refills() == 0);
+} FC_LOG_AND_RETHROW()
+
+BOOST_AUTO_TEST_CASE(take_card_follows_sorted_shoe) try {
+    std::mt19937_64 rng(4);
+    std::array<uint8_t, 52> shoe;
+    shoe.fill(8);
+    std::vector<uint8_t> sorted;
+    for (int value = 0; value < 52; value++) {
+        sorted.insert(sorted.end(), 8, value);
+    }
+    while (!sorted.empty()) {
+        const uint32_t idx = rng() % sorted.size();
+        BOOST_REQUIRE_EQUAL(blackjack::take_card(shoe, idx), sorted[idx]);
+        sorted.erase(sorted.begin() + idx);
+    }
 } FC_LOG_AND_RETHROW()
 
 // ----------------------------
@@ -622,7 +804,7 @@ BOOST_FIXTURE_TEST_CASE(check_state_after_split, blackjack_tester) try {
     push_cards(ses_id, {"8s", "Kh"});
     signidice(game_name, ses_id);
 
-    const auto& state = get_state(ses_id);
+    const auto& state = get_active_box(ses_id);
     const cards_t active_cards{"6d", "8s"}, split_cards{"6s", "Kh"};
     BOOST_REQUIRE_EQUAL(state["active_cards"].as<cards_t>(), active_cards);
     BOOST_REQUIRE_EQUAL(state["split_cards"].as<cards_t>(), split_cards);
@@ -912,6 +1094,21 @@ BOOST_FIXTURE_TEST_CASE(double_down_game_message, blackjack_tester) {
     BOOST_REQUIRE_EQUAL(get_dealer_finish_cards(), cards_t{"Kh"});
 }
 
+BOOST_FIXTURE_TEST_CASE(game_finish_message_size, blackjack_tester) {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(ses_id, STRSYM("100.0000"));
+
+    push_cards(ses_id, {"8c", "3s", "Td"});
+    signidice(game_name, ses_id);
+
+    double_down(ses_id);
+    push_cards(ses_id, {"As", "Kh"});
+    signidice(game_name, ses_id);
+
+    // version, 1 player's card and 1 dealer's card fit in a single param after the length
+    BOOST_REQUIRE_EQUAL(get_game_finish_message().size(), 1 + 8);
+}
+
 BOOST_FIXTURE_TEST_CASE(split_game_message, blackjack_tester) {
     const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
     bet(ses_id, STRSYM("100.0000"));
@@ -958,6 +1155,102 @@ BOOST_FIXTURE_TEST_CASE(split_game_message_blackjack_both, blackjack_tester) {
     BOOST_REQUIRE_EQUAL(get_dealer_finish_cards(), dealer_cards);
 }
 
+// multiple boxes
+
+BOOST_FIXTURE_TEST_CASE(boxes_bet_limit, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("6.0000"));
+    BOOST_REQUIRE_EQUAL(
+        push_action(
+            game_name,
+            N(gameaction),
+            {platform_name, N(gameaction)},
+            mvo()("req_id", ses_id)("type", 0)("params", std::vector<param_t>(18, 1'0000))
+        ),
+        wasm_assert_msg("too many boxes")
+    );
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(boxes_win_lose, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("200.0000"));
+    bet_boxes(ses_id, {STRSYM("100.0000"), STRSYM("100.0000")});
+
+    // 1st box: Kd 6s, 2nd box: Ts Qh, dealer: Td
+    push_cards(ses_id, {"Kd", "6s", "Ts", "Qh", "Td"});
+    signidice(game_name, ses_id);
+    BOOST_REQUIRE_EQUAL(get_game_message_cards(), cards_t({"Kd", "6s", "Ts", "Qh", "Td"}));
+
+    // moving to the next box doesn't require a random
+    stand(ses_id);
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["active_box"].as<uint32_t>(), 1);
+
+    // open dealer's cards, Td 8c, total = 18
+    stand(ses_id);
+    push_cards(ses_id, {"8c"});
+    signidice(game_name, ses_id);
+
+    check_player_win(STRSYM("0.0000"));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(boxes_blackjack_waits_for_dealer, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("200.0000"));
+    bet_boxes(ses_id, {STRSYM("100.0000"), STRSYM("100.0000")});
+
+    push_cards(ses_id, {"Ad", "Ks", "Ts", "9h", "Td"});
+    signidice(game_name, ses_id);
+    // 1st box has a blackjack so the player starts with the 2nd one
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["active_box"].as<uint32_t>(), 1);
+
+    // open dealer's cards, Td Qc, total = 20
+    stand(ses_id);
+    push_cards(ses_id, {"Qc"});
+    signidice(game_name, ses_id);
+
+    // 100 * 1.5 - 100
+    check_player_win(STRSYM("50.0000"));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(boxes_bust_then_double, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("200.0000"));
+    bet_boxes(ses_id, {STRSYM("100.0000"), STRSYM("100.0000")});
+
+    push_cards(ses_id, {"Kd", "6s", "6c", "5h", "Td"});
+    signidice(game_name, ses_id);
+
+    // 1st box busts
+    hit(ses_id);
+    push_cards(ses_id, {"Kc"});
+    signidice(game_name, ses_id);
+
+    // 2nd box doubles with 11 and gets 21, dealer has Td Qc
+    double_down(ses_id);
+    push_cards(ses_id, {"Ks", "Qc"});
+    signidice(game_name, ses_id);
+
+    // -100 + 200
+    check_player_win(STRSYM("100.0000"));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(boxes_split_then_next_box, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("200.0000"));
+    bet_boxes(ses_id, {STRSYM("100.0000"), STRSYM("100.0000")});
+
+    push_cards(ses_id, {"8d", "8s", "Ts", "9h", "Td"});
+    signidice(game_name, ses_id);
+
+    split(ses_id);
+    push_cards(ses_id, {"Kc", "Tc"});
+    signidice(game_name, ses_id);
+
+    // both split hands and the 2nd box stand, dealer has Td 7c
+    stand(ses_id);
+    stand(ses_id);
+    stand(ses_id);
+    push_cards(ses_id, {"7c"});
+    signidice(game_name, ses_id);
+
+    check_player_win(STRSYM("300.0000"));
+} FC_LOG_AND_RETHROW()
+
 // side bets
 
 BOOST_FIXTURE_TEST_CASE(pair_unsuited, blackjack_tester) {
@@ -1074,6 +1367,238 @@ BOOST_FIXTURE_TEST_CASE(pair_bet_double_down, blackjack_tester) try {
     check_player_win(STRSYM("80.0000"));
 } FC_LOG_AND_RETHROW()
 
+// max win reservation tests
+
+BOOST_FIXTURE_TEST_CASE(max_win_reservation, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(ses_id, STRSYM("100.0000"));
+    // player may split and double both hands
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("400.0000"));
+
+    push_cards(ses_id, {"5d", "5s", "Td"});
+    signidice(game_name, ses_id);
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("400.0000"));
+
+    // no split or double after a hit
+    hit(ses_id);
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("100.0000"));
+    push_cards(ses_id, {"Ks"});
+    signidice(game_name, ses_id);
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("100.0000"));
+
+    stand(ses_id);
+    push_cards(ses_id, {"7c"});
+    signidice(game_name, ses_id);
+    check_player_win(STRSYM("100.0000"));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(max_win_reservation_side_bets, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("120.0000"));
+    bet(ses_id, STRSYM("100.0000"), STRSYM("10.0000"), STRSYM("10.0000"));
+    // 4 * 100 + 25 * 10 + 100 * 10
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("1650.0000"));
+
+    // side bets are settled: 8 * 10 - 10, player can split tens but cannot double them
+    push_cards(ses_id, {"Tc", "Ts", "2d"});
+    signidice(game_name, ses_id);
+    BOOST_REQUIRE_EQUAL(get_state(ses_id)["max_player_win"].as<asset>(), STRSYM("270.0000"));
+} FC_LOG_AND_RETHROW()
+
+// stats tests
+
+BOOST_FIXTURE_TEST_CASE(stats_split_double, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("110.0000"));
+    bet(ses_id, STRSYM("100.0000"), STRSYM("10.0000"));
+
+    push_cards(ses_id, {"6d", "6s", "Td"});
+    signidice(game_name, ses_id);
+
+    split(ses_id);
+    push_cards(ses_id, {"5s", "Kh"});
+    signidice(game_name, ses_id);
+
+    // player doubles with 6d 5s and gets 4h, total = 15
+    double_down(ses_id);
+    push_cards(ses_id, {"4h"});
+    signidice(game_name, ses_id);
+
+    // player hits with 6s Kh and busts
+    hit(ses_id);
+    push_cards(ses_id, {"Tc", "9h"});
+    signidice(game_name, ses_id);
+    // -200 - 100 + 10 * 8
+    check_player_win(-STRSYM("220.0000"));
+
+    const auto stats = get_stats();
+    BOOST_REQUIRE_EQUAL(stats["rounds"].as<uint64_t>(), 1);
+    BOOST_REQUIRE_EQUAL(stats["boxes"].as<uint64_t>(), 1);
+    BOOST_REQUIRE_EQUAL(stats["ante_wagered"].as<asset>(), STRSYM("300.0000"));
+    BOOST_REQUIRE_EQUAL(stats["ante_paid"].as<asset>(), STRSYM("0.0000"));
+    BOOST_REQUIRE_EQUAL(stats["side_bets_wagered"].as<asset>(), STRSYM("10.0000"));
+    BOOST_REQUIRE_EQUAL(stats["side_bets_paid"].as<asset>(), STRSYM("90.0000"));
+    BOOST_REQUIRE_EQUAL(stats["splits"].as<uint64_t>(), 1);
+    BOOST_REQUIRE_EQUAL(stats["doubles"].as<uint64_t>(), 1);
+    BOOST_REQUIRE_EQUAL(stats["busts"].as<uint64_t>(), 1);
+    BOOST_REQUIRE_EQUAL(stats["blackjacks"].as<uint64_t>(), 0);
+    const auto first_three_hits = stats["first_three_hits"].as<std::vector<uint64_t>>();
+    BOOST_REQUIRE_EQUAL(first_three_hits[static_cast<int>(card_game::combination::PAIR)], 1);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(stats_accumulate, blackjack_tester) try {
+    for (int i = 0; i < 2; i++) {
+        const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+        bet(ses_id, STRSYM("100.0000"));
+        push_cards(ses_id, {"Ad", "Ts", "2c", "7c"});
+        signidice(game_name, ses_id);
+    }
+    const auto stats = get_stats();
+    BOOST_REQUIRE_EQUAL(stats["rounds"].as<uint64_t>(), 2);
+    BOOST_REQUIRE_EQUAL(stats["blackjacks"].as<uint64_t>(), 2);
+    BOOST_REQUIRE_EQUAL(stats["ante_wagered"].as<asset>(), STRSYM("200.0000"));
+    BOOST_REQUIRE_EQUAL(stats["ante_paid"].as<asset>(), STRSYM("500.0000"));
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(ev_hint, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(ses_id, STRSYM("100.0000"));
+    push_cards(ses_id, {"5d", "5s", "9c", "2c", "Th"});
+    signidice(game_name, ses_id);
+
+    // a pair of fives against a 9
+    auto hint = get_ev_hint(ses_id);
+    const auto& expected = blackjack::hint::evs[blackjack::hint::get_class({"5d", "5s"})][8];
+    BOOST_REQUIRE_EQUAL(hint["hit"].as<int64_t>(), 1162);
+    BOOST_REQUIRE_EQUAL(hint["stand"].as<int64_t>(), -5419);
+    BOOST_REQUIRE_EQUAL(hint["split"].as<int64_t>(), -5165);
+    BOOST_REQUIRE_EQUAL(hint["double_down"].as<int64_t>(), 1440);
+    BOOST_REQUIRE_EQUAL(hint["double_down"].as<int64_t>(), expected[3]);
+    // doubling a 10 against a 9 beats hitting
+    BOOST_REQUIRE_GT(hint["double_down"].as<int64_t>(), hint["hit"].as<int64_t>());
+
+    // a hard 12 against a 9 after the 2c
+    hit(ses_id);
+    signidice(game_name, ses_id);
+    hint = get_ev_hint(ses_id);
+    BOOST_REQUIRE_EQUAL(hint["hit"].as<int64_t>(), -3427);
+    BOOST_REQUIRE_EQUAL(hint["stand"].as<int64_t>(), -5419);
+    BOOST_REQUIRE(hint["split"].is_null());
+    BOOST_REQUIRE(hint["double_down"].is_null());
+} FC_LOG_AND_RETHROW()
+
+// scripted shoe tests
+
+struct scripted_game {
+    const char* name;
+    cards_t shoe;
+    std::string decisions;
+    asset win;
+};
+
+BOOST_FIXTURE_TEST_CASE(scripted_games, blackjack_tester) try {
+    const std::vector<scripted_game> games = {
+        {"stand and win", {"Kd", "9s", "Td", "8c"}, "S", STRSYM("100.0000")},
+        {"hit two times and win", {"Kd", "5s", "Td", "4s", "Ad", "5c", "4d"}, "HHS", STRSYM("100.0000")},
+        {"double and win", {"6d", "5s", "Td", "8s", "7d"}, "D", STRSYM("200.0000")},
+        {"split win win", {"6d", "6s", "Td", "8s", "Kh", "5h", "4c", "2c", "6h"}, "PHSHS", STRSYM("200.0000")},
+        {"split double lose win", {"6d", "6s", "Td", "5s", "Kh", "4h", "4c", "9h"}, "PDHS", -STRSYM("100.0000")},
+        {"split aces", {"Ad", "As", "Td", "9s", "Ac", "Qd"}, "P", -STRSYM("100.0000")},
+    };
+    for (const auto& g : games) {
+        BOOST_TEST_CONTEXT(g.name) {
+            const auto balance = get_balance(player_name);
+            const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+            bet(ses_id, STRSYM("100.0000"));
+            play_scripted(ses_id, g.shoe, g.decisions);
+            BOOST_REQUIRE_EQUAL(get_balance(player_name) - balance, g.win);
+        }
+    }
+} FC_LOG_AND_RETHROW()
+
+// every non-blackjack two card hand against every dealer's up card, player stands
+BOOST_FIXTURE_TEST_CASE(scripted_stand_matrix, blackjack_tester) try {
+    const std::string ranks = "23456789TA";
+    // dealer's hole card goes first, a few tails so the dealer both busts and stands
+    const std::vector<cards_t> tails = {{"7c", "Td"}, {"Ac", "5d", "Qh"}, {"Th", "Kc"}, {"2c", "3d", "4h", "Ks"}};
+
+    // ENHC: a dealer's blackjack beats any other hand, the dealer stands on all 17s
+    const auto expected = [](const cards_t& player, const cards_t& dealer) {
+        const auto p = get_weight(player), d = get_weight(dealer);
+        if ((dealer.size() == 2 && d == 21) || (d <= 21 && d > p)) {
+            return -1;
+        }
+        return d > 21 || p > d ? 1 : 0;
+    };
+
+    int games = 0;
+    for (int i = 0; i < ranks.size(); i++) {
+        for (int j = i; j < ranks.size(); j++) {
+            for (const char up : ranks) {
+                const cards_t player = {card(std::string{ranks[i], 'c'}), card(std::string{ranks[j], 'd'})};
+                if (get_weight(player) == 21) {
+                    continue;
+                }
+                const auto& tail = tails[games++ % tails.size()];
+
+                cards_t dealer = {card(std::string{up, 'h'})};
+                for (const auto& c : tail) {
+                    if (get_weight(dealer) >= 17) {
+                        break;
+                    }
+                    dealer.push_back(c);
+                }
+                BOOST_REQUIRE(get_weight(dealer) >= 17);
+
+                cards_t shoe = player;
+                shoe.push_back(dealer[0]);
+                shoe.insert(shoe.end(), tail.begin(), tail.end());
+
+                BOOST_TEST_CONTEXT(player[0].to_string() << player[1].to_string() << " vs " << up) {
+                    const auto balance = get_balance(player_name);
+                    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+                    bet(ses_id, STRSYM("100.0000"));
+                    play_scripted(ses_id, shoe, "S");
+                    BOOST_REQUIRE_EQUAL(get_balance(player_name) - balance, asset(expected(player, dealer) * 100'0000, symbol(CORE_SYM)));
+                }
+            }
+        }
+    }
+    BOOST_REQUIRE_EQUAL(games, 54 * 10);
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(scripted_shoe_rejects_invalid_cards, blackjack_tester) try {
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(ses_id, STRSYM("100.0000"));
+    BOOST_REQUIRE_EQUAL(
+        push_action(
+            game_name,
+            N(pushshoe),
+            {game_name, N(active)},
+            mvo()
+                ("ses_id", ses_id)
+                ("cards", fc::variants{0, 51, 52})
+        ),
+        wasm_assert_msg("invalid card id")
+    );
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(scripted_shoe_shorter_than_deal, blackjack_tester) try {
+    // the script covers the player's cards only, the dealer's card and the rest are drawn
+    const auto ses_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(ses_id, STRSYM("100.0000"));
+    push_cards(ses_id, {"Tc", "7d"});
+    signidice(game_name, ses_id);
+    BOOST_REQUIRE_EQUAL(get_active_box(ses_id)["active_cards"].as<cards_t>(), (cards_t{"Tc", "7d"}));
+    // a split's two cards after a script of one
+    const auto split_id = new_game_session(game_name, player_name, casino_id, STRSYM("100.0000"));
+    bet(split_id, STRSYM("100.0000"));
+    push_cards(split_id, {"8c", "8d", "Th"});
+    signidice(game_name, split_id);
+    split(split_id);
+    push_cards(split_id, {"3s"});
+    signidice(game_name, split_id);
+    BOOST_REQUIRE_EQUAL(get_active_box(split_id)["active_cards"].as<cards_t>()[1], card("3s"));
+} FC_LOG_AND_RETHROW()
+
 // max payout tests
 
 BOOST_FIXTURE_TEST_CASE(max_payout_basic, blackjack_tester) {
@@ -1125,6 +1650,34 @@ BOOST_FIXTURE_TEST_CASE(max_payout_split, blackjack_tester) {
 
 #endif
 
+// ----------------------------
+// continuous shuffling
+
+// param::continuous_shuffle is 5
+struct continuous_shuffle_tester : blackjack_tester {
+    continuous_shuffle_tester(): blackjack_tester({{5, 1}}) {}
+};
+
+BOOST_FIXTURE_TEST_CASE(default_games_never_touch_casino_shoe, blackjack_tester) try {
+    for (int i = 0; i < 5; i++) {
+        play_standing();
+    }
+    BOOST_REQUIRE(get_casino_shoe_row().empty());
+} FC_LOG_AND_RETHROW()
+
+BOOST_FIXTURE_TEST_CASE(continuous_shuffle_needs_casino_opt_in, continuous_shuffle_tester) try {
+    // the param alone leaves the machine off
+    for (int i = 0; i < 5; i++) {
+        play_standing();
+    }
+    BOOST_REQUIRE(get_casino_shoe_row().empty());
+
+    BOOST_REQUIRE_EQUAL(set_shuffle(true, player_name), "missing authority of " + game_name.to_string());
+    BOOST_REQUIRE_EQUAL(set_shuffle(true), success());
+    play_standing();
+    BOOST_REQUIRE(!get_casino_shoe_row().empty());
+} FC_LOG_AND_RETHROW()
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace testing
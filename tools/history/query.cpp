@@ -0,0 +1,177 @@
+// Queries hand history segments written by native_scenarios and bankroll_sim: counts the matching
+// hands and reports what was staked on them, paid out and the RTP. Blocks ruled out by their
+// headers are skipped without touching their columns.
+//
+// Usage: history_query [ --up <ranks> ] [ --doubled yes|no ] [ --split yes|no ] [ --blackjack yes|no ]
+//                      [ --dealer-bust yes|no ] [ --side-bets yes|no ] [ --min-ante <BET> ] [ --max-ante <BET> ]
+//                      [ --by-up ] [ --print <n> ] <segment or directory>...
+// Ranks of --up are card characters, e.g. --up A or --up TJQK.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+#include "store.hpp"
+
+using namespace blackjack::history;
+
+namespace {
+
+const int64_t bet_unit = 10000;
+const char rank_chars[] = "23456789TJQKA";
+
+std::string cards_string(const cards_t& cards) {
+    std::string s;
+    for (const auto& c : cards) {
+        s += (s.empty() ? "" : " ") + c.to_string();
+    }
+    return s;
+}
+
+rank_mask parse_ranks(const std::string& s) {
+    rank_mask mask = 0;
+    for (const char c : s) {
+        const char* p = std::strchr(rank_chars, c);
+        if (!p || !c) {
+            throw std::invalid_argument("unknown rank: " + std::string(1, c));
+        }
+        mask |= 1 << (p - rank_chars);
+    }
+    return mask;
+}
+
+void parse_flag(query& q, uint8_t f, const std::string& value) {
+    if (value == "yes") {
+        q.flags_all |= f;
+    } else if (value == "no") {
+        q.flags_none |= f;
+    } else {
+        throw std::invalid_argument("expected yes or no: " + value);
+    }
+}
+
+// segments of a directory are its *.bjh files
+void add_path(std::vector<std::string>& paths, const std::string& path) {
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0 || !S_ISDIR(st.st_mode)) {
+        paths.push_back(path);
+        return;
+    }
+    DIR* dir = opendir(path.c_str());
+    std::vector<std::string> names;
+    while (const auto* e = readdir(dir)) {
+        const std::string name = e->d_name;
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".bjh") == 0) {
+            names.push_back(path + "/" + name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end());
+    paths.insert(paths.end(), names.begin(), names.end());
+}
+
+void print_result(const std::string& name, const query_result& r) {
+    std::cout << name << std::fixed << std::setprecision(4) << "hands " << r.hands << ", staked "
+              << double(r.staked) / bet_unit << " BET, paid " << double(r.payout) / bet_unit << " BET, rtp "
+              << std::setprecision(6) << r.rtp() << std::defaultfloat << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    query q;
+    bool by_up = false;
+    uint64_t print = 0;
+    std::vector<std::string> paths;
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            const auto value = [&]() -> std::string {
+                if (i + 1 == argc) {
+                    throw std::invalid_argument("missing value of " + arg);
+                }
+                return argv[++i];
+            };
+            if (arg == "--up") {
+                q.up_ranks = parse_ranks(value());
+            } else if (arg == "--doubled") {
+                parse_flag(q, flag::doubled, value());
+            } else if (arg == "--split") {
+                parse_flag(q, flag::split, value());
+            } else if (arg == "--blackjack") {
+                parse_flag(q, flag::player_blackjack, value());
+            } else if (arg == "--dealer-bust") {
+                parse_flag(q, flag::dealer_bust, value());
+            } else if (arg == "--side-bets") {
+                parse_flag(q, flag::side_bets, value());
+            } else if (arg == "--min-ante") {
+                q.min_ante = std::llround(std::stod(value()) * bet_unit);
+            } else if (arg == "--max-ante") {
+                q.max_ante = std::llround(std::stod(value()) * bet_unit);
+            } else if (arg == "--by-up") {
+                by_up = true;
+            } else if (arg == "--print") {
+                print = std::stoull(value());
+            } else if (arg.rfind("--", 0) == 0) {
+                throw std::invalid_argument("unknown option: " + arg);
+            } else {
+                add_path(paths, arg);
+            }
+        }
+        if (paths.empty()) {
+            throw std::invalid_argument("no segments given");
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const store s(paths);
+        const auto r = run(s, q);
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        std::cout << paths.size() << " segments, " << s.rows() << " hands in " << s.blocks().size() << " blocks, "
+                  << r.blocks_scanned << " scanned, " << r.blocks_skipped << " skipped in " << elapsed.count() << "s ("
+                  << std::setprecision(3) << s.rows() / elapsed.count() / 1e6 << "M hands/s)" << std::endl;
+        print_result("", r);
+
+        if (by_up) {
+            for (int rank = 0; rank < 13; rank++) {
+                if (!(q.up_ranks >> rank & 1)) {
+                    continue;
+                }
+                auto by_rank = q;
+                by_rank.up_ranks = 1 << rank;
+                print_result(std::string("  up ") + rank_chars[rank] + ": ", run(s, by_rank));
+            }
+        }
+
+        for (const auto& b : s.blocks()) {
+            if (!print || q.skips(*b.header)) {
+                continue;
+            }
+            for (uint32_t i = 0; i < b.rows() && print; i++) {
+                if (!q.matches(b, i)) {
+                    continue;
+                }
+                const auto h = b.get(i);
+                std::cout << "[" << cards_string(h.first_hand) << "]";
+                if (!h.second_hand.empty()) {
+                    std::cout << " [" << cards_string(h.second_hand) << "]";
+                }
+                std::cout << " vs [" << cards_string(h.dealer_cards) << "]" << (h.doubled ? " doubled" : "")
+                          << ", staked " << double(h.staked) / bet_unit << ", paid " << double(h.payout) / bet_unit << std::endl;
+                print--;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        std::cerr << "Usage: history_query [ <filters> ] [ --by-up ] [ --print <n> ] <segment or directory>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,420 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+// card.hpp takes eosio::check from the including code
+#include <eosio/eosio.hpp>
+#include <blackjack/card.hpp>
+
+// Append-only columnar store of finished hands.
+//
+// A segment file is an 8 byte magic followed by blocks of up to block_rows hands. A block is a header
+// with the block's min/max index, then its columns: int64 amounts, uint32 offsets into the cards bytes,
+// one byte columns of the dealer's up card, the player's first two cards and the flags, and the cards
+// of every hand as [first hand count][cards][second hand count][cards][dealer count][cards].
+// Blocks are padded to 8 bytes, so columns of a memory-mapped segment are read in place.
+// Every writer appends to its own segment; a block torn by a crash is cut off when the segment is reopened.
+namespace blackjack { namespace history {
+
+using card_game::card;
+using card_game::cards_t;
+
+namespace flag {
+    const uint8_t doubled = 1;
+    const uint8_t split = 2;
+    const uint8_t player_blackjack = 4;
+    const uint8_t dealer_bust = 8;
+    const uint8_t side_bets = 16;
+}
+
+struct hand_record {
+    cards_t first_hand;
+    // cards of the second hand after a split
+    cards_t second_hand;
+    cards_t dealer_cards;
+    bool doubled = false;
+    // amounts in the smallest units of the asset
+    int64_t ante = 0;
+    int64_t pair = 0;
+    int64_t first_three = 0;
+    // everything the player deposited, with doubles and splits
+    int64_t staked = 0;
+    int64_t payout = 0;
+};
+
+const char segment_magic[8] = {'B', 'J', 'H', 'I', 'S', 'T', 0, 1};
+const uint32_t block_magic = 0x424a4842; // "BHJB"
+const uint32_t block_rows = 65536;
+
+// dealer's up card ranks as a bitmask, bit r for card_game rank r (0 is a two, 12 an ace)
+using rank_mask = uint16_t;
+const rank_mask all_ranks = (1 << 13) - 1;
+
+struct block_header {
+    uint32_t magic;
+    uint32_t rows;
+    // the whole block with the header and padding
+    uint64_t size;
+    uint64_t cards_size;
+    rank_mask up_ranks;
+    // flags set in some of the rows and in all of them
+    uint8_t flags_any;
+    uint8_t flags_all;
+    uint32_t reserved;
+    int64_t min_ante, max_ante;
+    int64_t min_staked, max_staked;
+    int64_t min_payout, max_payout;
+};
+static_assert(sizeof(block_header) % 8 == 0, "columns after the header must be aligned");
+
+inline uint64_t padded(uint64_t size) {
+    return (size + 7) & ~uint64_t(7);
+}
+
+inline uint64_t block_size(uint32_t rows, uint64_t cards_size) {
+    return sizeof(block_header) + padded(5 * 8 * uint64_t(rows) + 4 * (uint64_t(rows) + 1) + 4 * uint64_t(rows) + cards_size);
+}
+
+// columns of a block in a mapped segment
+struct block_view {
+    const block_header* header;
+    const int64_t* ante;
+    const int64_t* pair;
+    const int64_t* first_three;
+    const int64_t* staked;
+    const int64_t* payout;
+    const uint32_t* card_offsets;
+    const uint8_t* up;
+    const uint8_t* first;
+    const uint8_t* second;
+    const uint8_t* flags;
+    const uint8_t* cards;
+
+    explicit block_view(const uint8_t* p): header(reinterpret_cast<const block_header*>(p)) {
+        const uint32_t n = header->rows;
+        p += sizeof(block_header);
+        ante = reinterpret_cast<const int64_t*>(p);
+        pair = ante + n;
+        first_three = pair + n;
+        staked = first_three + n;
+        payout = staked + n;
+        card_offsets = reinterpret_cast<const uint32_t*>(payout + n);
+        up = reinterpret_cast<const uint8_t*>(card_offsets + n + 1);
+        first = up + n;
+        second = first + n;
+        flags = second + n;
+        cards = flags + n;
+    }
+
+    uint32_t rows() const {
+        return header->rows;
+    }
+
+    hand_record get(uint32_t row) const {
+        hand_record r;
+        const uint8_t* c = cards + card_offsets[row];
+        for (auto* hand : {&r.first_hand, &r.second_hand, &r.dealer_cards}) {
+            hand->resize(*c++);
+            for (auto& x : *hand) {
+                x = card(*c++);
+            }
+        }
+        r.doubled = flags[row] & flag::doubled;
+        r.ante = ante[row];
+        r.pair = pair[row];
+        r.first_three = first_three[row];
+        r.staked = staked[row];
+        r.payout = payout[row];
+        return r;
+    }
+};
+
+// offsets of the complete blocks of a segment's bytes, a torn tail is left out
+inline std::vector<uint64_t> scan_blocks(const uint8_t* data, uint64_t size) {
+    std::vector<uint64_t> blocks;
+    uint64_t pos = sizeof(segment_magic);
+    while (pos + sizeof(block_header) <= size) {
+        block_header h;
+        std::memcpy(&h, data + pos, sizeof(h));
+        if (h.magic != block_magic || h.size != block_size(h.rows, h.cards_size) || pos + h.size > size) {
+            break;
+        }
+        blocks.push_back(pos);
+        pos += h.size;
+    }
+    return blocks;
+}
+
+class writer {
+public:
+    explicit writer(const std::string& path) {
+        fd = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("can't open " + path);
+        }
+        struct stat st;
+        fstat(fd, &st);
+        if (st.st_size == 0) {
+            write_all(segment_magic, sizeof(segment_magic));
+            end = sizeof(segment_magic);
+            return;
+        }
+        char magic[sizeof(segment_magic)];
+        if (pread(fd, magic, sizeof(magic), 0) != ssize_t(sizeof(magic)) || std::memcmp(magic, segment_magic, sizeof(magic)) != 0) {
+            throw std::runtime_error(path + " isn't a hand history segment");
+        }
+        // only the headers are read, blocks are skipped by their sizes
+        end = sizeof(segment_magic);
+        block_header h;
+        while (pread(fd, &h, sizeof(h), end) == ssize_t(sizeof(h)) && h.magic == block_magic
+               && h.size == block_size(h.rows, h.cards_size) && end + h.size <= uint64_t(st.st_size)) {
+            end += h.size;
+        }
+        // a block torn by a crash
+        if (ftruncate(fd, end) != 0) {
+            throw std::runtime_error("can't truncate " + path);
+        }
+    }
+
+    writer(const writer&) = delete;
+    writer& operator=(const writer&) = delete;
+
+    ~writer() {
+        try {
+            flush();
+        } catch (...) {
+        }
+        ::close(fd);
+    }
+
+    void append(const hand_record& r) {
+        const card up = r.dealer_cards.empty() ? card() : r.dealer_cards.front();
+        uint8_t flags = r.doubled ? flag::doubled : 0;
+        if (!r.second_hand.empty()) {
+            flags |= flag::split;
+        }
+        if (r.second_hand.empty() && r.first_hand.size() == 2 && card_game::get_weight(r.first_hand) == 21) {
+            flags |= flag::player_blackjack;
+        }
+        if (card_game::get_weight(r.dealer_cards) > 21) {
+            flags |= flag::dealer_bust;
+        }
+        if (r.pair || r.first_three) {
+            flags |= flag::side_bets;
+        }
+        ante.push_back(r.ante);
+        pair.push_back(r.pair);
+        first_three.push_back(r.first_three);
+        staked.push_back(r.staked);
+        payout.push_back(r.payout);
+        card_offsets.push_back(cards.size());
+        this->up.push_back(up.get_value());
+        first.push_back(r.first_hand.size() > 0 ? r.first_hand[0].get_value() : 0xff);
+        second.push_back(r.first_hand.size() > 1 ? r.first_hand[1].get_value() : 0xff);
+        this->flags.push_back(flags);
+        for (const auto* hand : {&r.first_hand, &r.second_hand, &r.dealer_cards}) {
+            cards.push_back(hand->size());
+            for (const auto& c : *hand) {
+                cards.push_back(c.get_value());
+            }
+        }
+        if (ante.size() == block_rows) {
+            flush();
+        }
+    }
+
+    // writes the pending rows as a block
+    void flush() {
+        const uint32_t n = ante.size();
+        if (n == 0) {
+            return;
+        }
+        card_offsets.push_back(cards.size());
+        block_header h{};
+        h.magic = block_magic;
+        h.rows = n;
+        h.cards_size = cards.size();
+        h.size = block_size(n, h.cards_size);
+        h.flags_all = 0xff;
+        h.min_ante = h.min_staked = h.min_payout = std::numeric_limits<int64_t>::max();
+        h.max_ante = h.max_staked = h.max_payout = std::numeric_limits<int64_t>::min();
+        for (uint32_t i = 0; i < n; i++) {
+            if (up[i] < 52) {
+                h.up_ranks |= 1 << (up[i] / 4);
+            }
+            h.flags_any |= flags[i];
+            h.flags_all &= flags[i];
+            h.min_ante = std::min(h.min_ante, ante[i]);
+            h.max_ante = std::max(h.max_ante, ante[i]);
+            h.min_staked = std::min(h.min_staked, staked[i]);
+            h.max_staked = std::max(h.max_staked, staked[i]);
+            h.min_payout = std::min(h.min_payout, payout[i]);
+            h.max_payout = std::max(h.max_payout, payout[i]);
+        }
+        std::vector<uint8_t> block;
+        block.reserve(h.size);
+        const auto put = [&](const void* p, size_t size) {
+            block.insert(block.end(), static_cast<const uint8_t*>(p), static_cast<const uint8_t*>(p) + size);
+        };
+        put(&h, sizeof(h));
+        for (const auto* column : {&ante, &pair, &first_three, &staked, &payout}) {
+            put(column->data(), column->size() * 8);
+        }
+        put(card_offsets.data(), card_offsets.size() * 4);
+        for (const auto* column : {&up, &first, &second, &flags, &cards}) {
+            put(column->data(), column->size());
+        }
+        block.resize(h.size);
+        if (pwrite(fd, block.data(), block.size(), end) != ssize_t(block.size())) {
+            throw std::runtime_error("can't write a hand history block");
+        }
+        end += block.size();
+        for (auto* column : {&ante, &pair, &first_three, &staked, &payout}) {
+            column->clear();
+        }
+        card_offsets.clear();
+        for (auto* column : {&up, &first, &second, &flags, &cards}) {
+            column->clear();
+        }
+    }
+
+private:
+    int fd = -1;
+    uint64_t end = 0;
+    std::vector<int64_t> ante, pair, first_three, staked, payout;
+    std::vector<uint32_t> card_offsets;
+    std::vector<uint8_t> up, first, second, flags, cards;
+
+    void write_all(const void* p, size_t size) {
+        if (::write(fd, p, size) != ssize_t(size)) {
+            throw std::runtime_error("can't write a hand history segment");
+        }
+    }
+};
+
+// read-only memory-mapped segments
+class store {
+public:
+    explicit store(const std::vector<std::string>& paths) {
+        for (const auto& path : paths) {
+            map(path);
+        }
+    }
+
+    store(const store&) = delete;
+    store& operator=(const store&) = delete;
+
+    ~store() {
+        for (const auto& [data, size] : mappings) {
+            munmap(const_cast<uint8_t*>(data), size);
+        }
+    }
+
+    const std::vector<block_view>& blocks() const {
+        return views;
+    }
+
+    uint64_t rows() const {
+        uint64_t n = 0;
+        for (const auto& b : views) {
+            n += b.rows();
+        }
+        return n;
+    }
+
+private:
+    std::vector<std::pair<const uint8_t*, size_t>> mappings;
+    std::vector<block_view> views;
+
+    void map(const std::string& path) {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("can't open " + path);
+        }
+        struct stat st;
+        fstat(fd, &st);
+        if (st.st_size < ssize_t(sizeof(segment_magic))) {
+            ::close(fd);
+            throw std::runtime_error(path + " isn't a hand history segment");
+        }
+        void* p = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) {
+            throw std::runtime_error("can't map " + path);
+        }
+        const auto* data = static_cast<const uint8_t*>(p);
+        if (std::memcmp(data, segment_magic, sizeof(segment_magic)) != 0) {
+            munmap(p, st.st_size);
+            throw std::runtime_error(path + " isn't a hand history segment");
+        }
+        mappings.emplace_back(data, st.st_size);
+        madvise(p, st.st_size, MADV_SEQUENTIAL);
+        for (const auto offset : scan_blocks(data, st.st_size)) {
+            views.emplace_back(data + offset);
+        }
+    }
+};
+
+// hands of the dealer's up card ranks, with all of flags_all and none of flags_none, in the ante range
+struct query {
+    rank_mask up_ranks = all_ranks;
+    uint8_t flags_all = 0;
+    uint8_t flags_none = 0;
+    int64_t min_ante = std::numeric_limits<int64_t>::min();
+    int64_t max_ante = std::numeric_limits<int64_t>::max();
+
+    // whether the block's index rules out every row
+    bool skips(const block_header& h) const {
+        return !(h.up_ranks & up_ranks) || (h.flags_any & flags_all) != flags_all || (h.flags_all & flags_none)
+            || h.max_ante < min_ante || h.min_ante > max_ante;
+    }
+
+    bool matches(const block_view& b, uint32_t i) const {
+        return b.up[i] < 52 && (up_ranks >> (b.up[i] / 4) & 1) && (b.flags[i] & flags_all) == flags_all
+            && !(b.flags[i] & flags_none) && b.ante[i] >= min_ante && b.ante[i] <= max_ante;
+    }
+};
+
+struct query_result {
+    uint64_t hands = 0;
+    int64_t staked = 0;
+    int64_t payout = 0;
+    uint64_t blocks_scanned = 0;
+    uint64_t blocks_skipped = 0;
+
+    double rtp() const {
+        return staked ? double(payout) / staked : 0;
+    }
+};
+
+inline query_result run(const store& s, const query& q) {
+    query_result r;
+    for (const auto& b : s.blocks()) {
+        if (q.skips(*b.header)) {
+            r.blocks_skipped++;
+            continue;
+        }
+        r.blocks_scanned++;
+        for (uint32_t i = 0; i < b.rows(); i++) {
+            if (q.matches(b, i)) {
+                r.hands++;
+                r.staked += b.staked[i];
+                r.payout += b.payout[i];
+            }
+        }
+    }
+    return r;
+}
+
+}} // ns blackjack::history
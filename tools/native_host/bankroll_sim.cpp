@@ -0,0 +1,415 @@
+// Casino bankroll simulation: thousands of sessions open at once, every step advances a random one
+// by a transaction, the way players interleave on chain. A session reserves its max win above the deposit
+// (update_max_win) as long as it's open; the casino refuses a session it can't reserve for.
+// Every path plays a number of rounds and tracks the realised bankroll, the reserved exposure and ruin.
+// Paths are independent and spread over processes.
+//
+// Usage: bankroll_sim [ --bankroll <BET> ] [ --ruin <BET> ] [ --sessions <n> ] [ --rounds <n> ] [ --paths <n> ]
+//                     [ --jobs <n> ] [ --seed <s> ] [ --strategy <name> ] [ --path-csv <file> ] [ --history <dir> ]
+//                     [ --params <min ante>,<max ante>,<max payout>,<max pair>,<max first three> ]
+//                     [ --mix <weight>:<ante>,<pair>,<first three> ]...
+// Amounts are in BET; mix entries are picked by weight for every new session, e.g.
+// --mix 90:1,0,0 --mix 9:100,5,5 --mix 1:10000,1000,1000
+// With --history every path appends its hands to the segment <dir>/path_<n>.bjh, see history_query.
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "play.hpp"
+
+using namespace blackjack::simulation;
+
+namespace {
+
+struct mix_entry {
+    double weight = 1;
+    box_bet bet;
+};
+
+struct options {
+    int64_t bankroll = 1'000'000'0000;
+    int64_t ruin = 0;
+    int sessions = 1000;
+    int64_t rounds = 1'000'000;
+    int paths = 16;
+    int jobs = int(sysconf(_SC_NPROCESSORS_ONLN));
+    uint64_t seed = 0;
+    strategy_t strategy = strategy_t::optimal;
+    std::string path_csv;
+    std::string history;
+    std::map<uint16_t, param_t> params = default_params;
+    std::vector<mix_entry> mix;
+};
+
+// sent from the worker processes as is
+struct path_result {
+    int64_t final_bankroll = 0;
+    int64_t min_bankroll = 0;
+    // rounds played, -1 if the path isn't ruined
+    int64_t ruined_at = -1;
+    int64_t games = 0;
+    // sessions the casino couldn't reserve for
+    int64_t refused = 0;
+    int64_t wagered = 0;
+    int64_t max_reserved = 0;
+    // average over the steps
+    double mean_reserved = 0;
+    // sums over the games of the highest reservation and of the realised casino loss, if any
+    int64_t peak_reservations = 0;
+    int64_t realised_losses = 0;
+};
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
+
+int64_t to_amount(double bet) {
+    return std::llround(bet * ante.amount);
+}
+
+std::string amount(int64_t a) {
+    return asset(a, core_symbol).to_string();
+}
+
+std::vector<double> parse_amounts(const std::string& s, size_t count, const std::string& what) {
+    std::vector<double> values;
+    std::istringstream in(s);
+    for (std::string v; std::getline(in, v, ',');) {
+        values.push_back(std::atof(v.c_str()));
+    }
+    if (values.size() != count) {
+        throw std::invalid_argument(what + " expects " + std::to_string(count) + " amounts: " + s);
+    }
+    return values;
+}
+
+options parse_options(int argc, char** argv) {
+    options o;
+    for (int i = 1; i < argc; i += 2) {
+        const std::string arg = argv[i];
+        if (i + 1 == argc) {
+            throw std::invalid_argument("missing value of " + arg);
+        }
+        const std::string value = argv[i + 1];
+        if (arg == "--bankroll") {
+            o.bankroll = to_amount(std::atof(value.c_str()));
+        } else if (arg == "--ruin") {
+            o.ruin = to_amount(std::atof(value.c_str()));
+        } else if (arg == "--sessions") {
+            o.sessions = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--rounds") {
+            o.rounds = std::atoll(value.c_str());
+        } else if (arg == "--paths") {
+            o.paths = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--jobs") {
+            o.jobs = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--seed") {
+            o.seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--strategy") {
+            o.strategy = parse_strategy(value);
+        } else if (arg == "--path-csv") {
+            o.path_csv = value;
+        } else if (arg == "--history") {
+            o.history = value;
+        } else if (arg == "--params") {
+            const auto v = parse_amounts(value, 5, arg);
+            o.params = {
+                {blackjack::param::min_ante, to_amount(v[0])},
+                {blackjack::param::max_ante, to_amount(v[1])},
+                {blackjack::param::max_payout, to_amount(v[2])},
+                {blackjack::param::max_pair, to_amount(v[3])},
+                {blackjack::param::max_first_three, to_amount(v[4])},
+            };
+        } else if (arg == "--mix") {
+            const auto colon = value.find(':');
+            if (colon == std::string::npos) {
+                throw std::invalid_argument("--mix expects <weight>:<ante>,<pair>,<first three>: " + value);
+            }
+            const auto v = parse_amounts(value.substr(colon + 1), 3, arg);
+            mix_entry e;
+            e.weight = std::atof(value.substr(0, colon).c_str());
+            e.bet.ante = asset(to_amount(v[0]), core_symbol);
+            e.bet.pair = asset(to_amount(v[1]), core_symbol);
+            e.bet.first_three = asset(to_amount(v[2]), core_symbol);
+            o.mix.push_back(e);
+        } else {
+            throw std::invalid_argument("unknown option: " + arg);
+        }
+    }
+    if (o.mix.empty()) {
+        o.mix.push_back({});
+    }
+    return o;
+}
+
+// the contract checks bets against the params, a mix it refuses would only make failed sessions
+void check_mix(const options& o) {
+    driver_t d(o.params);
+    for (const auto& e : o.mix) {
+        try {
+            const auto ses_id = d.new_game(e.bet.total());
+            d.action(ses_id, blackjack::action::bet,
+                     {param_t(e.bet.ante.amount), param_t(e.bet.pair.amount), param_t(e.bet.first_three.amount)});
+        } catch (const eosio::check_failure& err) {
+            throw std::invalid_argument("bet of " + e.bet.total().to_string() + " is refused by the params: " + err.what());
+        }
+    }
+}
+
+// a session's reservation is its max payout above what the player has deposited
+int64_t reservation(const driver_t& d, uint64_t ses_id) {
+    const auto& ses = d.session(ses_id);
+    return std::max<int64_t>(ses.max_win.amount - ses.deposit.amount, 0);
+}
+
+class path {
+public:
+    path(const options& o, int index):
+        o(o), d(o.params, splitmix64(o.seed ^ index), eosio::name("blackjack")),
+        rng(splitmix64(o.seed ^ index) + 1), slots(o.sessions) {
+        for (const auto& e : o.mix) {
+            weights.push_back(e.weight);
+        }
+        pick_bet = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+        r.final_bankroll = r.min_bankroll = o.bankroll;
+        if (!o.history.empty()) {
+            history = std::make_unique<blackjack::history::writer>(o.history + "/path_" + std::to_string(index) + ".bjh");
+        }
+    }
+
+    path_result run(std::ostream* csv) {
+        const int64_t csv_every = std::max<int64_t>(1, o.rounds / 1000);
+        int64_t steps = 0;
+        long double reserved_steps = 0;
+        std::uniform_int_distribution<int> pick_slot(0, o.sessions - 1);
+        while (started < o.rounds || open > 0) {
+            auto& s = slots[pick_slot(rng)];
+            if (!s.ses_id) {
+                if (started == o.rounds) {
+                    continue;
+                }
+                start(s);
+            } else {
+                advance(s);
+            }
+            steps++;
+            reserved_steps += reserved;
+            if (csv && s.finished_now && r.games % csv_every == 0) {
+                *csv << r.games << "," << double(r.final_bankroll) / ante.amount << "," << double(reserved) / ante.amount << "\n";
+            }
+            if (r.final_bankroll <= o.ruin) {
+                r.ruined_at = r.games;
+                break;
+            }
+        }
+        r.mean_reserved = steps ? double(reserved_steps / steps) : 0;
+        return r;
+    }
+
+private:
+    struct slot {
+        std::optional<uint64_t> ses_id;
+        int64_t reserved = 0;
+        int64_t peak = 0;
+        bool finished_now = false;
+        box_bet bet;
+        hand_tracker hand;
+    };
+
+    const options& o;
+    driver_t d;
+    std::mt19937_64 rng;
+    std::vector<double> weights;
+    std::discrete_distribution<size_t> pick_bet;
+    std::vector<slot> slots;
+    path_result r;
+    int64_t started = 0;
+    int open = 0;
+    int64_t reserved = 0;
+    std::unique_ptr<blackjack::history::writer> history;
+
+    void reserve(slot& s, int64_t amount) {
+        reserved += amount - s.reserved;
+        s.reserved = amount;
+        s.peak = std::max(s.peak, amount);
+        r.max_reserved = std::max(r.max_reserved, reserved);
+    }
+
+    void start(slot& s) {
+        s.finished_now = false;
+        started++;
+        const auto& bet = o.mix[pick_bet(rng)].bet;
+        const auto ses_id = d.new_game(bet.total());
+        d.action(ses_id, blackjack::action::bet,
+                 {param_t(bet.ante.amount), param_t(bet.pair.amount), param_t(bet.first_three.amount)});
+        // what's still free of the bankroll has to cover the new session's max win
+        if (reservation(d, ses_id) > r.final_bankroll - reserved) {
+            r.refused++;
+            game_sdk::host::get().sessions.erase(ses_id);
+            return;
+        }
+        s.ses_id = ses_id;
+        s.peak = 0;
+        s.bet = bet;
+        s.hand = {};
+        open++;
+        reserve(s, reservation(d, ses_id));
+    }
+
+    void advance(slot& s) {
+        const auto ses_id = *s.ses_id;
+        if (d.session(ses_id).random_required) {
+            d.random(ses_id);
+        } else {
+            blackjack::blackjack::state_table states(d.get_self(), d.get_self().value);
+            const auto& state = states.get(ses_id);
+            const auto decision = decide(o.strategy, state);
+            s.hand.before(state, decision);
+            const bool raise = decision == blackjack::strategy::double_down || decision == blackjack::strategy::split;
+            d.action(ses_id, blackjack::action::play, {decision}, raise ? state.active().ante : asset());
+        }
+        if (!d.finished(ses_id)) {
+            reserve(s, reservation(d, ses_id));
+            return;
+        }
+        const auto& ses = d.session(ses_id);
+        if (history) {
+            history->append(s.hand.finish(ses, s.bet));
+        }
+        const int64_t casino_win = ses.deposit.amount - ses.payout->amount;
+        r.final_bankroll += casino_win;
+        r.min_bankroll = std::min(r.min_bankroll, r.final_bankroll);
+        r.wagered += ses.deposit.amount;
+        r.games++;
+        r.peak_reservations += s.peak;
+        r.realised_losses += std::max<int64_t>(-casino_win, 0);
+        reserve(s, 0);
+        s.ses_id.reset();
+        s.finished_now = true;
+        open--;
+        game_sdk::host::get().sessions.erase(ses_id);
+    }
+};
+
+// paths job, job + jobs, ...
+std::vector<path_result> run_job(const options& o, int job) {
+    std::vector<path_result> results;
+    for (int i = job; i < o.paths; i += o.jobs) {
+        std::ofstream csv;
+        if (i == 0 && !o.path_csv.empty()) {
+            csv.open(o.path_csv);
+            csv << "games,bankroll,reserved\n";
+        }
+        results.push_back(path(o, i).run(csv.is_open() ? &csv : nullptr));
+    }
+    return results;
+}
+
+std::vector<path_result> run_paths(const options& o) {
+    // the host is process-wide, so jobs are processes reporting their paths through pipes
+    std::vector<std::pair<pid_t, int>> workers;
+    for (int job = 1; job < std::min(o.jobs, o.paths); job++) {
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("can't create a pipe");
+        }
+        const pid_t pid = fork();
+        if (pid == 0) {
+            close(fds[0]);
+            const auto results = run_job(o, job);
+            const auto size = results.size() * sizeof(path_result);
+            const bool ok = write(fds[1], results.data(), size) == ssize_t(size);
+            _exit(ok ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+        close(fds[1]);
+        workers.emplace_back(pid, fds[0]);
+    }
+    auto results = run_job(o, 0);
+    for (const auto& [pid, fd] : workers) {
+        path_result result;
+        while (read(fd, &result, sizeof(result)) == ssize_t(sizeof(result))) {
+            results.push_back(result);
+        }
+        close(fd);
+        int status;
+        waitpid(pid, &status, 0);
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+            throw std::runtime_error("a worker process failed");
+        }
+    }
+    return results;
+}
+
+template <typename T, typename F>
+T quantile(const std::vector<path_result>& results, double q, F&& field) {
+    std::vector<T> values;
+    for (const auto& r : results) {
+        values.push_back(field(r));
+    }
+    std::sort(values.begin(), values.end());
+    return values[std::min(values.size() - 1, size_t(q * values.size()))];
+}
+
+void report(const options& o, const std::vector<path_result>& results) {
+    int ruined = 0;
+    int64_t games = 0, refused = 0, wagered = 0, won = 0, peaks = 0, losses = 0, max_reserved = 0;
+    double mean_reserved = 0;
+    for (const auto& r : results) {
+        ruined += r.ruined_at >= 0;
+        games += r.games;
+        refused += r.refused;
+        wagered += r.wagered;
+        won += r.final_bankroll - o.bankroll;
+        peaks += r.peak_reservations;
+        losses += r.realised_losses;
+        max_reserved = std::max(max_reserved, r.max_reserved);
+        mean_reserved += r.mean_reserved / results.size();
+    }
+    const double n = results.size();
+    const double p = ruined / n;
+    std::cout << results.size() << " paths of " << o.rounds << " rounds, " << o.sessions << " concurrent sessions, bankroll "
+              << amount(o.bankroll) << std::endl;
+    std::cout << std::setprecision(4) << "ruin probability " << p << " +- " << blackjack::rtp::z95 * std::sqrt(p * (1 - p) / n)
+              << " (" << ruined << " paths)" << std::endl;
+    std::cout << "games " << games << ", refused sessions " << refused << ", casino edge "
+              << (wagered ? double(won) / wagered : 0.) << std::endl;
+    const auto final_bankroll = [](const path_result& r) { return r.final_bankroll; };
+    const auto min_bankroll = [](const path_result& r) { return r.min_bankroll; };
+    for (const double q : {0.01, 0.05, 0.5, 0.95}) {
+        std::cout << "q" << std::left << std::setw(5) << q << std::right << " final bankroll "
+                  << amount(quantile<int64_t>(results, q, final_bankroll)) << ", min bankroll "
+                  << amount(quantile<int64_t>(results, q, min_bankroll)) << std::endl;
+    }
+    std::cout << "reserved: mean " << amount(std::llround(mean_reserved)) << ", max " << amount(max_reserved) << std::endl;
+    std::cout << "per game: peak reservation " << amount(games ? peaks / games : 0) << ", realised loss "
+              << amount(games ? losses / games : 0) << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    try {
+        const auto o = parse_options(argc, argv);
+        check_mix(o);
+        if (!o.history.empty()) {
+            mkdir(o.history.c_str(), 0755);
+        }
+        report(o, run_paths(o));
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
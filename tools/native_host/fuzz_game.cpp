@@ -0,0 +1,442 @@
+// Differential fuzzer of the game state machine. An input is decoded into a session:
+// boxes and bets, then a sequence of decisions, randoms and scripted shoes with arbitrary cards.
+// Every step runs through the contract natively and is checked against the constexpr state table
+// and the reserve invariants; a rejected step must leave the session as it was.
+//
+// Built with libFuzzer (-DNATIVE_HOST_LIBFUZZER=ON) it only provides LLVMFuzzerTestOneInput,
+// otherwise it has its own generator:
+//
+//   fuzz_game [ <runs> [ <seed> [ <jobs> ] ] ]  - random inputs in <jobs> processes, one per core by default,
+//                                                a failing one is saved to crash-<seed>-<run>.bin
+//   fuzz_game <input file>...                   - replays saved inputs
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <blackjack/blackjack.hpp>
+#include <native_host/driver.hpp>
+
+using blackjack::card;
+using blackjack::cards_t;
+using blackjack::fsm::event;
+using eosio::asset;
+using game_sdk::param_t;
+
+namespace {
+
+using contract_t = blackjack::blackjack;
+using driver_t = native_host::driver<contract_t>;
+
+const eosio::symbol core_symbol{"BET", 4};
+const auto self = eosio::name("blackjack");
+const int decks = 8;
+
+const std::map<uint16_t, param_t> params = {
+    {blackjack::param::min_ante, 1'0000},
+    {blackjack::param::max_ante, 100'0000},
+    {blackjack::param::max_payout, 1'000'0000},
+    {blackjack::param::max_pair, 30'0000},
+    {blackjack::param::max_first_three, 10'0000},
+};
+
+std::string failure;
+long sessions = 0, steps = 0;
+
+#define FUZZ_CHECK(cond, msg) \
+    do { if (!(cond)) { failure = msg; return false; } } while (0)
+
+// reads the input byte by byte, zeroes once it's over
+class input_reader {
+    const uint8_t* data;
+    size_t size;
+public:
+    input_reader(const uint8_t* data, size_t size): data(data), size(size) {}
+
+    bool empty() const { return size == 0; }
+
+    uint8_t next() {
+        if (!size) {
+            return 0;
+        }
+        size--;
+        return *data++;
+    }
+};
+
+const contract_t::state_row* get_state(uint64_t ses_id) {
+    contract_t::state_table state(self, self.value);
+    const auto it = state.find(ses_id);
+    return it != state.end() ? &*it : nullptr;
+}
+
+// calls f for every card in play, they're checked on every step so they aren't copied
+template <typename F>
+void for_each_card_in_play(const contract_t::state_row& row, F&& f) {
+    for (const auto& box : row.boxes) {
+        std::for_each(box.active_cards.begin(), box.active_cards.end(), f);
+        std::for_each(box.split_cards.begin(), box.split_cards.end(), f);
+    }
+    if (row.dealer_card) {
+        f(row.dealer_card);
+    }
+}
+
+// invariants of a session between the steps
+bool check_session(const driver_t& d, uint64_t ses_id, bool scripted) {
+    const auto& ses = d.session(ses_id);
+    const auto* row = get_state(ses_id);
+
+    if (ses.payout) {
+        FUZZ_CHECK(!row, "state row of a finished game is left");
+        FUZZ_CHECK(ses.payout->amount >= 0, "negative payout");
+        FUZZ_CHECK(*ses.payout <= ses.max_win, "payout exceeds the reserved max win");
+        FUZZ_CHECK(!ses.action_required && !ses.random_required, "finished game awaits something");
+        return true;
+    }
+
+    FUZZ_CHECK(row, "state row of an active game is missing");
+    FUZZ_CHECK(row->state < blackjack::fsm::finished, "invalid stored state");
+    const auto by_state = contract_t::state_table(self, self.value).get_index<"bystate"_n>();
+    const auto indexed = by_state.find(contract_t::state_row::state_key(row->state, ses_id));
+    FUZZ_CHECK(indexed != by_state.end() && &*indexed == row, "bystate index doesn't follow the state");
+    FUZZ_CHECK(ses.random_required == blackjack::fsm::awaits_random(row->state), "random requirement doesn't match the state");
+    FUZZ_CHECK(ses.action_required.has_value() == blackjack::fsm::awaits_action(row->state), "action requirement doesn't match the state");
+
+    // max win is reserved once the bet is placed
+    if (!row->boxes.empty()) {
+        FUZZ_CHECK(ses.max_win >= ses.deposit, "max win is under the deposit");
+        FUZZ_CHECK(row->active_box < row->boxes.size(), "active box is out of range");
+        FUZZ_CHECK(ses.deposit >= row->staked_sum(), "staked more than deposited");
+    }
+    int copies[52] = {};
+    bool valid = true;
+    for_each_card_in_play(*row, [&](const card& c) {
+        valid = valid && c;
+        if (c) {
+            copies[c.get_value()]++;
+        }
+    });
+    FUZZ_CHECK(valid, "invalid card in play");
+    // a scripted shoe may deal any card any number of times
+    FUZZ_CHECK(scripted || *std::max_element(std::begin(copies), std::end(copies)) <= decks,
+               "card dealt more times than there are decks");
+    return true;
+}
+
+// the new state should follow from the constexpr table, or the game should be over
+bool check_transition(uint64_t ses_id, uint16_t from, event e) {
+    const auto* row = get_state(ses_id);
+    if (!row) {
+        FUZZ_CHECK(e == event::random, "game finished by an action");
+        FUZZ_CHECK(blackjack::fsm::awaits_random(from), "game finished from a state that doesn't await a random");
+        return true;
+    }
+    const auto expected = blackjack::fsm::next(from, e);
+    FUZZ_CHECK(expected != blackjack::fsm::illegal, "contract accepted an illegal transition");
+    // a stand that moves play to the next hand keeps require_play
+    FUZZ_CHECK(row->state == expected || (e == event::stand && row->state == blackjack::fsm::require_play),
+               "unexpected state " + std::to_string(row->state) + " after event " + std::to_string(int(e)) +
+               " from state " + std::to_string(from));
+    return true;
+}
+
+asset active_ante(uint64_t ses_id) {
+    contract_t::bet_table bet(self, self.value);
+    const auto it = bet.find(ses_id);
+    const auto* row = get_state(ses_id);
+    if (it == bet.end() || !row || row->active_box >= it->boxes.size()) {
+        return asset(1'0000, core_symbol);
+    }
+    return it->boxes[row->active_box].ante;
+}
+
+// what a rejected step must leave as it was
+auto summary(const driver_t& d, uint64_t ses_id) {
+    const auto& ses = d.session(ses_id);
+    const auto* row = get_state(ses_id);
+    return std::make_tuple(ses.payout, ses.action_required, ses.random_required, ses.deposit, ses.max_win,
+                           ses.messages.size(), row ? std::optional<uint16_t>(row->state) : std::nullopt);
+}
+
+// runs one step and checks it against the state table and, if known, whether it should be accepted
+template <typename F>
+bool step(driver_t& d, uint64_t ses_id, bool scripted, F&& f, std::optional<event> e, std::optional<bool> acceptable) {
+    steps++;
+    const auto before = summary(d, ses_id);
+    const auto from = std::get<6>(before);
+    try {
+        f();
+    } catch (const eosio::check_failure& err) {
+        FUZZ_CHECK(summary(d, ses_id) == before, std::string("rejected step changed the session: ") + err.what());
+        FUZZ_CHECK(acceptable != true, std::string("contract rejected a legal step: ") + err.what());
+        return true;
+    }
+    FUZZ_CHECK(acceptable != false, "contract accepted an illegal step" +
+               (e ? " (event " + std::to_string(int(*e)) + ")" : std::string()));
+    if (e && from) {
+        FUZZ_CHECK(blackjack::fsm::is_allowed(*from, *e), "contract accepted a disallowed event " + std::to_string(int(*e)) +
+                   " in state " + std::to_string(*from));
+        if (!check_transition(ses_id, *from, *e)) {
+            return false;
+        }
+    }
+    return check_session(d, ses_id, scripted);
+}
+
+// the table rules written down independently of the contract's checks
+bool is_legal(uint64_t ses_id, param_t decision, asset amount) {
+    const auto* row = get_state(ses_id);
+    if (!row || row->state != blackjack::fsm::require_play) {
+        return false;
+    }
+    const auto& box = row->active();
+    const auto& cards = box.active_cards;
+    switch (decision) {
+        case blackjack::decision::hit:
+        case blackjack::decision::stand:
+            return amount.amount == 0;
+        case blackjack::decision::split:
+            return !box.has_split() && cards.size() == 2 &&
+                   card_game::get_weight(cards[0]) == card_game::get_weight(cards[1]) && amount == active_ante(ses_id);
+        case blackjack::decision::double_down: {
+            const auto w = card_game::get_weight(cards);
+            return cards.size() == 2 && 9 <= w && w <= 11 && card_game::is_hard(cards) && amount == active_ante(ses_id);
+        }
+    }
+    return false;
+}
+
+const event decision_events[] = {event::hit, event::stand, event::split, event::double_down};
+
+// decisions in the order of event::hit..double_down, a wrong amount is transferred on request
+bool decide(driver_t& d, uint64_t ses_id, bool scripted, param_t decision, bool wrong_amount) {
+    const bool pays = decision == blackjack::decision::split || decision == blackjack::decision::double_down;
+    const auto amount = pays ? active_ante(ses_id) * (wrong_amount ? 2 : 1) : asset(0, core_symbol);
+    return step(d, ses_id, scripted, [&] { d.action(ses_id, blackjack::action::play, {decision}, amount); },
+                decision_events[decision], is_legal(ses_id, decision, amount));
+}
+
+// the first legal decision starting from the given one, hit is always legal
+bool decide_legal(driver_t& d, uint64_t ses_id, bool scripted, param_t decision) {
+    const auto ante = active_ante(ses_id);
+    while (decision > blackjack::decision::stand && !is_legal(ses_id, decision, ante)) {
+        decision = (decision + 1) % 4;
+    }
+    return decide(d, ses_id, scripted, decision, false);
+}
+
+bool run_session(driver_t& d, input_reader& in) {
+    // boxes and bets, a deposit that doesn't match them now and then
+    const int boxes = 1 + in.next() % 3;
+    std::vector<param_t> bet;
+    bet.reserve(3 * boxes);
+    int64_t deposit = 0;
+    for (int i = 0; i < boxes; i++) {
+        const uint8_t b = in.next();
+        bet.push_back(1'0000 * (1 + b % 4));
+        bet.push_back(b & 0x10 ? 1'0000 : 0);
+        bet.push_back(b & 0x20 ? 1'0000 : 0);
+        deposit += bet[bet.size() - 3] + bet[bet.size() - 2] + bet.back();
+    }
+    const bool deposit_matches = in.next() % 16 != 0;
+    if (!deposit_matches) {
+        deposit += 1'0000;
+    }
+
+    uint64_t ses_id;
+    sessions++;
+    try {
+        ses_id = d.new_game(asset(deposit, core_symbol));
+    } catch (const eosio::check_failure&) {
+        return true;
+    }
+    bool scripted = false;
+    if (!step(d, ses_id, scripted, [&] { d.action(ses_id, blackjack::action::bet, bet); }, event::bet, deposit_matches)) {
+        return false;
+    }
+    if (!deposit_matches) {
+        // the session is stuck waiting for a valid bet
+        return true;
+    }
+
+    // the win reserved at any point should cover whatever the player wins in the end
+    int64_t min_reserved = std::numeric_limits<int64_t>::max();
+    const auto track_reserve = [&] {
+        if (const auto* row = get_state(ses_id)) {
+            min_reserved = std::min(min_reserved, row->max_player_win.amount);
+        }
+    };
+    track_reserve();
+
+    while (!in.empty() && !d.finished(ses_id)) {
+        const uint8_t op = in.next();
+        bool ok = true;
+        // most steps deliver what the session awaits so that games get deep,
+        // the rest are scripted shoes, illegal decisions and steps out of turn
+        const bool awaits_random = d.session(ses_id).random_required;
+        switch (op % 16) {
+            case 12: {
+                std::vector<uint8_t> cards(1 + op / 16);
+                for (auto& c : cards) {
+                    c = in.next() % 52;
+                }
+                scripted = true;
+                ok = step(d, ses_id, scripted, [&] { d.call(ses_id, [&](contract_t& c) { c.pushshoe(ses_id, cards); }); },
+                          std::nullopt, true);
+                break;
+            }
+            case 13: case 14:
+                // any decision, legal or not, with a wrong amount now and then
+                ok = decide(d, ses_id, scripted, (op >> 4) % 4, op & 0x40);
+                break;
+            case 15:
+                // a random that isn't awaited, an unknown decision or a second bet
+                ok = step(d, ses_id, scripted, [&] {
+                    switch ((op >> 4) % 3) {
+                        case 0: d.random(ses_id); break;
+                        case 1: d.action(ses_id, blackjack::action::play, {param_t(4 + op / 64)}); break;
+                        case 2: d.action(ses_id, blackjack::action::bet, bet); break;
+                    }
+                }, std::nullopt, (op >> 4) % 3 == 0 ? std::optional<bool>(awaits_random) : false);
+                break;
+            default:
+                if (awaits_random) {
+                    ok = step(d, ses_id, scripted, [&] { d.random(ses_id); }, event::random, true);
+                } else {
+                    ok = decide_legal(d, ses_id, scripted, (op >> 4) % 4);
+                }
+        }
+        if (!ok) {
+            return false;
+        }
+        track_reserve();
+    }
+    if (d.finished(ses_id)) {
+        const auto& ses = d.session(ses_id);
+        FUZZ_CHECK(ses.payout->amount - ses.deposit.amount <= min_reserved,
+                   "win " + std::to_string(ses.payout->amount - ses.deposit.amount) +
+                   " exceeds the win reserved earlier " + std::to_string(min_reserved));
+    }
+    return true;
+}
+
+driver_t& get_driver() {
+    static driver_t d(params, 0, self);
+    return d;
+}
+
+// false with `failure` set if an invariant is broken
+bool run_input(const uint8_t* data, size_t size) {
+    auto& d = get_driver();
+    d.reset(params);
+    failure.clear();
+    input_reader in(data, size);
+    while (!in.empty()) {
+        if (!run_session(d, in)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // anonymous ns
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (!run_input(data, size)) {
+        std::cerr << "invariant broken: " << failure << std::endl;
+        std::abort();
+    }
+    return 0;
+}
+
+#ifndef NATIVE_HOST_LIBFUZZER
+int run_generated(long runs, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<uint8_t> input;
+    const auto start = std::chrono::steady_clock::now();
+    for (long run = 0; run < runs; run++) {
+        input.resize(8 + rng() % 120);
+        for (auto& b : input) {
+            b = rng();
+        }
+        if (!run_input(input.data(), input.size())) {
+            const auto file = "crash-" + std::to_string(seed) + "-" + std::to_string(run) + ".bin";
+            std::ofstream(file, std::ios::binary).write(reinterpret_cast<const char*>(input.data()), input.size());
+            std::cerr << "invariant broken: " << failure << ", input saved to " << file << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << runs << " inputs (seed " << seed << "), " << sessions << " sessions, " << steps << " steps in "
+              << elapsed.count() << "s, no invariants broken" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && !std::all_of(argv[1], argv[1] + std::strlen(argv[1]), ::isdigit)) {
+        for (int i = 1; i < argc; i++) {
+            std::ifstream f(argv[i], std::ios::binary);
+            const std::vector<uint8_t> input{std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>()};
+            if (!run_input(input.data(), input.size())) {
+                std::cerr << argv[i] << ": invariant broken: " << failure << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+
+    const long runs = argc > 1 ? std::atol(argv[1]) : 100000;
+    const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::random_device()();
+    const int jobs = argc > 3 ? std::max(1, std::atoi(argv[3])) : std::max(1, int(std::thread::hardware_concurrency()));
+
+    // the host is process-wide, so jobs are processes, each with its own seed;
+    // they send their counts back through a pipe for the overall rate
+    int counts[2];
+    if (pipe(counts) != 0) {
+        std::perror("pipe");
+        return EXIT_FAILURE;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (int job = 1; job < jobs; job++) {
+        if (fork() == 0) {
+            close(counts[0]);
+            const int result = run_generated(runs / jobs, seed + job);
+            const long job_counts[2] = {sessions, steps};
+            if (write(counts[1], job_counts, sizeof(job_counts)) != sizeof(job_counts)) {
+                std::perror("write");
+            }
+            return result;
+        }
+    }
+    close(counts[1]);
+    int result = run_generated(runs / jobs + runs % jobs, seed);
+    long total_sessions = sessions, total_steps = steps;
+    for (long job_counts[2]; read(counts[0], job_counts, sizeof(job_counts)) == sizeof(job_counts);) {
+        total_sessions += job_counts[0];
+        total_steps += job_counts[1];
+    }
+    for (int status; wait(&status) > 0;) {
+        if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS) {
+            result = EXIT_FAILURE;
+        }
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << jobs << " jobs: " << total_sessions << " sessions, " << total_steps << " steps in " << elapsed.count()
+              << "s, " << long(total_sessions / elapsed.count()) << " sessions/s" << std::endl;
+    return result;
+}
+#endif
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <eosio/check.hpp>
+
+namespace eosio {
+
+struct symbol {
+    uint64_t value = 0;
+
+    constexpr symbol() = default;
+    constexpr symbol(std::string_view code, uint8_t precision) {
+        for (auto it = code.rbegin(); it != code.rend(); ++it) {
+            value = (value << 8) | uint64_t(*it);
+        }
+        value = (value << 8) | precision;
+    }
+
+    constexpr uint8_t precision() const { return value & 0xff; }
+
+    friend constexpr bool operator==(const symbol& a, const symbol& b) { return a.value == b.value; }
+    friend constexpr bool operator!=(const symbol& a, const symbol& b) { return a.value != b.value; }
+};
+
+struct asset {
+    int64_t amount = 0;
+    symbol sym;
+
+    asset() = default;
+    asset(int64_t a, symbol s): amount(a), sym(s) {}
+
+    asset operator-() const { return asset(-amount, sym); }
+    asset& operator+=(const asset& a) { check(sym == a.sym, "attempt to add asset with different symbol"); amount += a.amount; return *this; }
+    asset& operator-=(const asset& a) { check(sym == a.sym, "attempt to subtract asset with different symbol"); amount -= a.amount; return *this; }
+    asset& operator*=(int64_t a) { amount *= a; return *this; }
+    asset& operator/=(int64_t a) { check(a != 0, "divide by zero"); amount /= a; return *this; }
+
+    friend asset operator+(asset a, const asset& b) { return a += b; }
+    friend asset operator-(asset a, const asset& b) { return a -= b; }
+    friend asset operator*(asset a, int64_t b) { return a *= b; }
+    friend asset operator*(int64_t b, asset a) { return a *= b; }
+    friend asset operator/(asset a, int64_t b) { return a /= b; }
+    friend int64_t operator/(const asset& a, const asset& b) { check(b.amount != 0, "divide by zero"); return a.amount / b.amount; }
+
+    friend bool operator==(const asset& a, const asset& b) { return a.amount == b.amount; }
+    friend bool operator!=(const asset& a, const asset& b) { return a.amount != b.amount; }
+    friend bool operator<(const asset& a, const asset& b) { return a.amount < b.amount; }
+    friend bool operator<=(const asset& a, const asset& b) { return a.amount <= b.amount; }
+    friend bool operator>(const asset& a, const asset& b) { return a.amount > b.amount; }
+    friend bool operator>=(const asset& a, const asset& b) { return a.amount >= b.amount; }
+
+    std::string to_string() const {
+        std::string s = std::to_string(amount < 0 ? -amount : amount);
+        const size_t p = sym.precision();
+        if (p > 0) {
+            s.insert(0, std::string(s.size() <= p ? p + 1 - s.size() : 0, '0'));
+            s.insert(s.size() - p, ".");
+        }
+        return (amount < 0 ? "-" : "") + s;
+    }
+};
+
+} // ns eosio
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdexcept>
+#include <string>
+
+namespace eosio {
+
+// a failed check aborts the "transaction", the driver rolls the tables back
+struct check_failure : std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+inline void check(bool pred, const char* msg) {
+    if (!pred) {
+        throw check_failure(msg);
+    }
+}
+
+inline void check(bool pred, const std::string& msg) {
+    if (!pred) {
+        throw check_failure(msg);
+    }
+}
+
+} // ns eosio
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace eosio {
+
+struct checksum256 {
+    std::array<uint8_t, 32> bytes{};
+
+    std::array<uint8_t, 32> extract_as_byte_array() const { return bytes; }
+    const uint8_t* data() const { return bytes.data(); }
+};
+
+} // ns eosio
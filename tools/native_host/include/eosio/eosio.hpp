@@ -0,0 +1,13 @@
+#pragma once
+
+// Native stand-in for the parts of eosio.cdt the contract uses,
+// tables are kept in memory and printing goes to eosio::console().
+#include <eosio/action.hpp>
+#include <eosio/asset.hpp>
+#include <eosio/check.hpp>
+#include <eosio/crypto.hpp>
+#include <eosio/multi_index.hpp>
+#include <eosio/name.hpp>
+#include <eosio/print.hpp>
+#include <eosio/serialize.hpp>
+#include <eosio/singleton.hpp>
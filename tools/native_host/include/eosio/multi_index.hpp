@@ -0,0 +1,325 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <set>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <eosio/check.hpp>
+#include <eosio/name.hpp>
+
+// eosio.cdt's libc has it for 128-bit secondary keys
+using uint128_t = unsigned __int128;
+
+namespace eosio {
+
+namespace detail {
+    // every table type registers itself, so the driver can clear all the rows;
+    // changes made during a transaction are logged, so they can be undone
+    // after a failed check like the chain does
+    class table_registry {
+        std::vector<std::function<void()>> clears;
+        std::vector<std::function<void()>> undo_log;
+        // rows with an entry in the undo log, a transaction touches a handful of them
+        std::vector<std::pair<const void*, uint64_t>> logged_rows;
+        bool in_transaction = false;
+
+    public:
+        static table_registry& get() {
+            static table_registry r;
+            return r;
+        }
+
+        void on_clear(std::function<void()> clear) {
+            clears.push_back(std::move(clear));
+        }
+
+        void clear() const {
+            for (const auto& c : clears) {
+                c();
+            }
+        }
+
+        void begin() {
+            undo_log.clear();
+            logged_rows.clear();
+            in_transaction = true;
+        }
+
+        void commit() {
+            undo_log.clear();
+            logged_rows.clear();
+            in_transaction = false;
+        }
+
+        void rollback() {
+            for (auto it = undo_log.rbegin(); it != undo_log.rend(); ++it) {
+                (*it)();
+            }
+            commit();
+        }
+
+        template <typename F>
+        void on_undo(const void* table, uint64_t pk, F&& undo) {
+            if (in_transaction) {
+                undo_log.emplace_back(std::forward<F>(undo));
+                logged_rows.emplace_back(table, pk);
+            }
+        }
+
+        // a modified row needn't be saved again: the undo of its first change in the transaction,
+        // run after the later ones, restores it
+        bool is_logged(const void* table, uint64_t pk) const {
+            return !in_transaction || std::find(logged_rows.begin(), logged_rows.end(), std::make_pair(table, pk)) != logged_rows.end();
+        }
+    };
+
+    // rows of every (code, scope) of a table type, inner containers are never erased,
+    // so tables may keep pointers to them
+    template <typename Rows>
+    std::map<std::pair<uint64_t, uint64_t>, Rows>& table_storage() {
+        static std::map<std::pair<uint64_t, uint64_t>, Rows> s = [] {
+            table_registry::get().on_clear([] {
+                for (auto& [key, rows] : table_storage<Rows>()) {
+                    rows = Rows();
+                }
+            });
+            return std::map<std::pair<uint64_t, uint64_t>, Rows>();
+        }();
+        return s;
+    }
+} // ns detail
+
+template <name::raw IndexName, typename Extractor>
+struct indexed_by {
+    static constexpr name::raw index_name = IndexName;
+    using extractor = Extractor;
+};
+
+template <class Class, class Type, Type (Class::*PtrToMemberFunction)() const>
+struct const_mem_fun {
+    using result_type = Type;
+
+    Type operator()(const Class& c) const {
+        return (c.*PtrToMemberFunction)();
+    }
+};
+
+template <name::raw TableName, typename T, typename... Indices>
+class multi_index {
+    using rows_t = std::map<uint64_t, T>;
+
+    // rows and the entries of every secondary index, (secondary key, primary key) pairs in the index's order
+    struct storage_t {
+        rows_t rows;
+        std::tuple<std::set<std::pair<typename Indices::extractor::result_type, uint64_t>>...> indices;
+    };
+
+    storage_t* storage;
+
+    template <size_t I>
+    static auto index_key(const T& obj) {
+        return typename std::tuple_element_t<I, std::tuple<Indices...>>::extractor()(obj);
+    }
+
+    template <size_t I>
+    static void update_index(storage_t& s, const T& obj, bool add) {
+        const auto entry = std::make_pair(index_key<I>(obj), obj.primary_key());
+        if (add) {
+            std::get<I>(s.indices).insert(entry);
+        } else {
+            std::get<I>(s.indices).erase(entry);
+        }
+    }
+
+    // moves the row's entry if its secondary key has changed
+    template <size_t I, typename Key>
+    static void reindex(storage_t& s, uint64_t pk, const Key& old_key, const T& obj) {
+        const auto key = index_key<I>(obj);
+        if (key != old_key) {
+            auto& entries = std::get<I>(s.indices);
+            entries.erase(std::make_pair(old_key, pk));
+            entries.emplace(key, pk);
+        }
+    }
+
+    // rows are mostly modified without a change of their secondary keys, their entries stay then
+    template <typename Lambda, size_t... I>
+    void update(T& obj, uint64_t pk, Lambda&& updater, std::index_sequence<I...>) {
+        [[maybe_unused]] const auto keys = std::make_tuple(index_key<I>(obj)...);
+        const auto reindex_all = [&] {
+            (reindex<I>(*storage, pk, std::get<I>(keys), obj), ...);
+        };
+        try {
+            updater(obj);
+        } catch (...) {
+            // the undo log unindexes the row by its keys as they are now
+            reindex_all();
+            throw;
+        }
+        reindex_all();
+    }
+
+    template <size_t... I>
+    static void update_indices([[maybe_unused]] storage_t& s, [[maybe_unused]] const T& obj, [[maybe_unused]] bool add,
+                               std::index_sequence<I...>) {
+        (update_index<I>(s, obj, add), ...);
+    }
+
+    static void index(storage_t& s, const T& obj) {
+        update_indices(s, obj, true, std::index_sequence_for<Indices...>());
+    }
+
+    static void unindex(storage_t& s, const T& obj) {
+        update_indices(s, obj, false, std::index_sequence_for<Indices...>());
+    }
+
+    template <name::raw IndexName>
+    static constexpr size_t index_position() {
+        constexpr name::raw names[] = {Indices::index_name..., IndexName};
+        size_t i = 0;
+        while (names[i] != IndexName) {
+            i++;
+        }
+        return i;
+    }
+
+public:
+    class const_iterator {
+        friend class multi_index;
+        typename rows_t::const_iterator it;
+
+        explicit const_iterator(typename rows_t::const_iterator i): it(i) {}
+    public:
+        const T& operator*() const { return it->second; }
+        const T* operator->() const { return &it->second; }
+        const_iterator& operator++() { ++it; return *this; }
+        const_iterator& operator--() { --it; return *this; }
+        friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.it == b.it; }
+        friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.it != b.it; }
+    };
+
+    // rows in the order of a secondary key, then the primary key
+    template <size_t I>
+    class secondary_index {
+        using key_t = typename std::tuple_element_t<I, std::tuple<Indices...>>::extractor::result_type;
+        using entries_t = std::tuple_element_t<I, decltype(storage_t::indices)>;
+
+        const storage_t* storage;
+
+    public:
+        class const_iterator {
+            friend class secondary_index;
+            const storage_t* storage;
+            typename entries_t::const_iterator it;
+
+            const_iterator(const storage_t* s, typename entries_t::const_iterator i): storage(s), it(i) {}
+        public:
+            const T& operator*() const { return storage->rows.at(it->second); }
+            const T* operator->() const { return &**this; }
+            const_iterator& operator++() { ++it; return *this; }
+            const_iterator& operator--() { --it; return *this; }
+            friend bool operator==(const const_iterator& a, const const_iterator& b) { return a.it == b.it; }
+            friend bool operator!=(const const_iterator& a, const const_iterator& b) { return a.it != b.it; }
+        };
+
+        explicit secondary_index(const storage_t* s): storage(s) {}
+
+        const_iterator begin() const { return {storage, entries().cbegin()}; }
+        const_iterator end() const { return {storage, entries().cend()}; }
+
+        // the first row with a key not less than the given one
+        const_iterator lower_bound(const key_t& key) const {
+            return {storage, entries().lower_bound({key, 0})};
+        }
+
+        // the first row with a key greater than the given one
+        const_iterator upper_bound(const key_t& key) const {
+            return {storage, entries().upper_bound({key, std::numeric_limits<uint64_t>::max()})};
+        }
+
+        const_iterator find(const key_t& key) const {
+            const auto it = lower_bound(key);
+            return it != end() && it.it->first == key ? it : end();
+        }
+
+    private:
+        const entries_t& entries() const {
+            return std::get<I>(storage->indices);
+        }
+    };
+
+    multi_index(name code, uint64_t scope):
+        storage(&detail::table_storage<storage_t>()[{code.value, scope}]) {}
+
+    const_iterator begin() const { return const_iterator(storage->rows.cbegin()); }
+    const_iterator end() const { return const_iterator(storage->rows.cend()); }
+
+    const_iterator find(uint64_t pk) const { return const_iterator(storage->rows.find(pk)); }
+
+    const_iterator require_find(uint64_t pk, const char* msg = "unable to find key") const {
+        const auto it = storage->rows.find(pk);
+        check(it != storage->rows.end(), msg);
+        return const_iterator(it);
+    }
+
+    const T& get(uint64_t pk, const char* msg = "unable to find key") const {
+        return *require_find(pk, msg);
+    }
+
+    template <name::raw IndexName>
+    auto get_index() const {
+        constexpr size_t i = index_position<IndexName>();
+        static_assert(i < sizeof...(Indices), "no index with this name");
+        return secondary_index<i>(storage);
+    }
+
+    template <typename Lambda>
+    const_iterator emplace(name, Lambda&& constructor) {
+        T obj{};
+        constructor(obj);
+        const auto pk = obj.primary_key();
+        check(storage->rows.find(pk) == storage->rows.end(), "could not insert object, most likely a uniqueness constraint was violated");
+        detail::table_registry::get().on_undo(storage, pk, [s = storage, pk] {
+            unindex(*s, s->rows.at(pk));
+            s->rows.erase(pk);
+        });
+        const auto it = storage->rows.emplace(pk, std::move(obj)).first;
+        index(*storage, it->second);
+        return const_iterator(it);
+    }
+
+    template <typename Lambda>
+    void modify(const_iterator itr, name, Lambda&& updater) {
+        check(itr != end(), "cannot pass end iterator to modify");
+        auto& obj = const_cast<T&>(*itr);
+        const auto pk = obj.primary_key();
+        auto& registry = detail::table_registry::get();
+        if (!registry.is_logged(storage, pk)) {
+            registry.on_undo(storage, pk, [s = storage, pk, old = obj] {
+                auto& row = s->rows.at(pk);
+                unindex(*s, row);
+                row = old;
+                index(*s, row);
+            });
+        }
+        update(obj, pk, std::forward<Lambda>(updater), std::index_sequence_for<Indices...>());
+        check(pk == obj.primary_key(), "updater cannot change primary key when modifying an object");
+    }
+
+    const_iterator erase(const_iterator itr) {
+        check(itr != end(), "cannot pass end iterator to erase");
+        detail::table_registry::get().on_undo(storage, itr->primary_key(), [s = storage, old = *itr] {
+            index(*s, s->rows.emplace(old.primary_key(), old).first->second);
+        });
+        unindex(*storage, *itr);
+        return const_iterator(storage->rows.erase(itr.it));
+    }
+};
+
+} // ns eosio
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace eosio {
+
+struct name {
+    enum class raw : uint64_t {};
+
+    uint64_t value = 0;
+
+    constexpr name() = default;
+    constexpr explicit name(uint64_t v): value(v) {}
+    constexpr name(raw r): value(static_cast<uint64_t>(r)) {}
+    constexpr explicit name(std::string_view str) {
+        for (int i = 0; i < 12 && i < int(str.size()); i++) {
+            value |= (char_to_value(str[i]) & 0x1f) << (64 - 5 * (i + 1));
+        }
+        if (str.size() > 12) {
+            value |= char_to_value(str[12]) & 0x0f;
+        }
+    }
+
+    static constexpr uint64_t char_to_value(char c) {
+        if (c >= '1' && c <= '5') {
+            return c - '1' + 1;
+        }
+        if (c >= 'a' && c <= 'z') {
+            return c - 'a' + 6;
+        }
+        return 0;
+    }
+
+    constexpr operator raw() const { return raw(value); }
+
+    friend constexpr bool operator==(const name& a, const name& b) { return a.value == b.value; }
+    friend constexpr bool operator!=(const name& a, const name& b) { return a.value != b.value; }
+    friend constexpr bool operator<(const name& a, const name& b) { return a.value < b.value; }
+};
+
+} // ns eosio
+
+template <typename T, T... Str>
+constexpr eosio::name operator""_n() {
+    constexpr const char buf[] = {Str...};
+    return eosio::name(std::string_view(buf, sizeof...(Str)));
+}
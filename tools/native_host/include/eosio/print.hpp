@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace eosio {
+
+// everything printed during the current action, the driver resets it
+inline std::string& console() {
+    static std::string buffer;
+    return buffer;
+}
+
+namespace detail {
+    inline void print_one(const char* s) { console() += s; }
+    inline void print_one(const std::string& s) { console() += s; }
+    inline void print_one(char c) { console() += c; }
+    inline void print_one(bool b) { console() += b ? "true" : "false"; }
+
+    template <typename T>
+    auto print_one(const T& v) -> std::enable_if_t<std::is_arithmetic_v<T>> {
+        console() += std::to_string(v);
+    }
+
+    template <typename T>
+    auto print_one(const T& v) -> decltype(v.to_string(), void()) {
+        console() += v.to_string();
+    }
+} // ns detail
+
+template <typename... Args>
+void print(Args&&... args) {
+    (detail::print_one(args), ...);
+}
+
+inline void print_f(const char* s) {
+    console() += s;
+}
+
+// every '%' is replaced with the next argument
+template <typename Arg, typename... Args>
+void print_f(const char* s, Arg&& arg, Args&&... args) {
+    for (; *s && *s != '%'; s++) {
+        console() += *s;
+    }
+    if (!*s) {
+        return;
+    }
+    detail::print_one(arg);
+    print_f(s + 1, std::forward<Args>(args)...);
+}
+
+} // ns eosio
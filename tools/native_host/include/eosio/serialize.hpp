@@ -0,0 +1,11 @@
+#pragma once
+
+// rows live in memory as C++ objects, nothing to serialize
+#define EOSLIB_SERIALIZE(TYPE, MEMBERS)
+
+namespace eosio {
+
+template <typename T>
+struct datastream {};
+
+} // ns eosio
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <optional>
+
+#include <eosio/multi_index.hpp>
+
+namespace eosio {
+
+template <name::raw SingletonName, typename T>
+class singleton {
+    std::optional<T>* value;
+
+public:
+    singleton(name code, uint64_t scope):
+        value(&detail::table_storage<std::optional<T>>()[{code.value, scope}]) {}
+
+    bool exists() const { return value->has_value(); }
+
+    T get() const {
+        check(exists(), "singleton does not exist");
+        return **value;
+    }
+
+    T get_or_default(const T& def = T()) const { return exists() ? **value : def; }
+
+    void set(const T& v, name) {
+        save();
+        *value = v;
+    }
+
+    void remove() {
+        save();
+        value->reset();
+    }
+
+private:
+    // the value as it was before the transaction is enough to undo it
+    void save() {
+        auto& registry = detail::table_registry::get();
+        if (!registry.is_logged(value, 0)) {
+            registry.on_undo(value, 0, [value = value, old = *value] { *value = old; });
+        }
+    }
+};
+
+} // ns eosio
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <eosio/eosio.hpp>
+
+// Native stand-in for game_sdk::game. The contract talks to an in-memory platform,
+// the native_host::driver plays the platform's part: it opens sessions, checks that
+// an action or a random is awaited and delivers it.
+namespace game_sdk {
+
+using param_t = uint64_t;
+using eosio::asset;
+using eosio::checksum256;
+using eosio::name;
+
+// xoshiro256** seeded with the random, deterministic but not the SDK's own generator
+class prng {
+    uint64_t s[4];
+
+    static uint64_t rotl(uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    }
+
+public:
+    using ptr = std::shared_ptr<prng>;
+
+    explicit prng(const checksum256& seed) {
+        const auto b = seed.extract_as_byte_array();
+        for (int i = 0; i < 4; i++) {
+            s[i] = 0;
+            for (int j = 0; j < 8; j++) {
+                s[i] = (s[i] << 8) | b[i * 8 + j];
+            }
+        }
+        if (!(s[0] | s[1] | s[2] | s[3])) {
+            s[0] = 1;
+        }
+    }
+
+    uint64_t next() {
+        const uint64_t result = rotl(s[1] * 5, 7) * 9;
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+        return result;
+    }
+};
+
+struct session {
+    uint64_t casino_id;
+    asset deposit;
+};
+
+// what the platform knows about a session
+struct session_state {
+    uint64_t casino_id = 0;
+    asset deposit;
+    asset max_win;
+    std::optional<uint16_t> action_required;
+    bool random_required = false;
+    // set once the game's finished
+    std::optional<asset> payout;
+    std::vector<std::vector<param_t>> messages;
+    std::vector<param_t> finish_message;
+};
+
+struct host {
+    std::map<uint16_t, param_t> params;
+    std::map<uint64_t, session_state> sessions;
+    // session of the action being executed
+    uint64_t current = 0;
+
+    static host& get() {
+        static host h;
+        return h;
+    }
+
+    session_state& session(uint64_t ses_id) {
+        const auto it = sessions.find(ses_id);
+        eosio::check(it != sessions.end(), "session not found");
+        return it->second;
+    }
+};
+
+class game {
+public:
+    const eosio::symbol core_symbol{"BET", 4};
+    const asset zero_asset{0, core_symbol};
+
+    game(name receiver, name, eosio::datastream<const char*>): _self(receiver) {}
+    virtual ~game() = default;
+
+    virtual void on_new_game(uint64_t ses_id) = 0;
+    virtual void on_action(uint64_t ses_id, uint16_t type, std::vector<param_t> params) = 0;
+    virtual void on_random(uint64_t ses_id, checksum256 rand) = 0;
+    virtual void on_finish([[maybe_unused]] uint64_t ses_id) {}
+
+    name get_self() const { return _self; }
+
+protected:
+    name _self;
+
+    std::optional<param_t> get_param_value(uint64_t, uint16_t type) const {
+        const auto& params = host::get().params;
+        const auto it = params.find(type);
+        return it != params.end() ? std::optional<param_t>(it->second) : std::nullopt;
+    }
+
+    session get_session(uint64_t ses_id) const {
+        const auto& ses = host::get().session(ses_id);
+        return session{ses.casino_id, ses.deposit};
+    }
+
+    void require_action(uint16_t type, bool = false) {
+        current().action_required = type;
+    }
+
+    void require_random() {
+        current().random_required = true;
+    }
+
+    void update_max_win(asset max_win) {
+        current().max_win = max_win;
+    }
+
+    void send_game_message(std::vector<param_t> msg) {
+        current().messages.push_back(std::move(msg));
+    }
+
+    void finish_game(asset payout, std::optional<std::vector<param_t>> msg) {
+        auto& ses = current();
+        eosio::check(payout <= ses.max_win, "player payout exceeds max win");
+        ses.payout = payout;
+        ses.action_required = std::nullopt;
+        ses.random_required = false;
+        ses.finish_message = msg ? std::move(*msg) : std::vector<param_t>();
+    }
+
+    prng::ptr get_prng(checksum256&& seed) const {
+        return std::make_shared<prng>(seed);
+    }
+
+private:
+    static session_state& current() {
+        return host::get().session(host::get().current);
+    }
+};
+
+} // ns game_sdk
+
+// actions are plain methods natively, there's no dispatcher to generate
+#define GAME_CONTRACT(TYPE)
+#define GAME_CONTRACT_CUSTOM_ACTIONS(TYPE, ACTIONS)
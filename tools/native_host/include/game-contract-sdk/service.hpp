@@ -0,0 +1,3 @@
+#pragma once
+
+#include <game-contract-sdk/game_base.hpp>
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <game-contract-sdk/game_base.hpp>
+
+// Runs the contract sources natively, without native-only code in them. The driver takes the platform's part:
+// every call is a "transaction" on a freshly constructed contract, a failed check
+// rolls the tables and the session back and is rethrown as eosio::check_failure.
+namespace native_host {
+
+using eosio::asset;
+using eosio::checksum256;
+using eosio::name;
+using game_sdk::param_t;
+using game_sdk::session_state;
+
+template <typename Contract>
+class driver {
+public:
+    explicit driver(std::map<uint16_t, param_t> params, uint64_t seed = 0, name self = name("game")):
+        self(self), seed(seed) {
+        reset(std::move(params));
+    }
+
+    // drops every table row and session
+    void reset(std::map<uint16_t, param_t> params) {
+        eosio::detail::table_registry::get().clear();
+        auto& h = game_sdk::host::get();
+        h = game_sdk::host();
+        h.params = std::move(params);
+        next_ses_id = 0;
+        nonce = 0;
+    }
+
+    uint64_t new_game(asset deposit, uint64_t casino_id = 0) {
+        const auto ses_id = next_ses_id++;
+        auto& ses = game_sdk::host::get().sessions[ses_id];
+        ses.casino_id = casino_id;
+        ses.deposit = deposit;
+        try {
+            transaction(ses_id, [&](Contract& c) { c.on_new_game(ses_id); });
+        } catch (...) {
+            game_sdk::host::get().sessions.erase(ses_id);
+            throw;
+        }
+        return ses_id;
+    }
+
+    // deposit is transferred along with the action, e.g. for a double down
+    void action(uint64_t ses_id, uint16_t type, std::vector<param_t> params, asset deposit = asset()) {
+        transaction(ses_id, [&](Contract& c) {
+            auto& ses = game_sdk::host::get().session(ses_id);
+            eosio::check(ses.action_required == type, "action isn't required");
+            ses.action_required = std::nullopt;
+            if (deposit.amount) {
+                ses.deposit += deposit;
+            }
+            c.on_action(ses_id, type, std::move(params));
+        });
+    }
+
+    void random(uint64_t ses_id, checksum256 rand) {
+        transaction(ses_id, [&](Contract& c) {
+            auto& ses = game_sdk::host::get().session(ses_id);
+            eosio::check(ses.random_required, "random isn't required");
+            ses.random_required = false;
+            c.on_random(ses_id, rand);
+        });
+    }
+
+    // a random derived from the driver's seed, the same seed replays the same games
+    void random(uint64_t ses_id) {
+        checksum256 rand;
+        uint64_t x = seed ^ (ses_id << 32) ^ nonce++;
+        for (int i = 0; i < 4; i++) {
+            x = splitmix64(x);
+            for (int j = 0; j < 8; j++) {
+                rand.bytes[i * 8 + j] = uint8_t(x >> (56 - 8 * j));
+            }
+        }
+        random(ses_id, rand);
+    }
+
+    // calls one of the contract's own actions on behalf of a session
+    template <typename F>
+    void call(uint64_t ses_id, F&& f) {
+        transaction(ses_id, std::forward<F>(f));
+    }
+
+    // calls one of the contract's own actions that isn't a session's, e.g. a casino's setting
+    template <typename F>
+    void call(F&& f) {
+        eosio::console().clear();
+        rollback_guard guard(nullptr);
+        Contract c(self, self, {});
+        f(c);
+        guard.commit();
+    }
+
+    const session_state& session(uint64_t ses_id) const {
+        return game_sdk::host::get().session(ses_id);
+    }
+
+    bool finished(uint64_t ses_id) const {
+        return session(ses_id).payout.has_value();
+    }
+
+    // the last transaction's console
+    const std::string& console() const {
+        return eosio::console();
+    }
+
+    name get_self() const {
+        return self;
+    }
+
+private:
+    name self;
+    uint64_t seed;
+    uint64_t next_ses_id = 0;
+    uint64_t nonce = 0;
+
+    static uint64_t splitmix64(uint64_t x) {
+        x += 0x9e3779b97f4a7c15;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+        return x ^ (x >> 31);
+    }
+
+    // undoes a transaction unless it's committed, so a failed check unwinds through the driver once
+    // rather than being caught and rethrown
+    class rollback_guard {
+        session_state* ses;
+        // messages are only appended and the finish message is only set with the payout
+        const std::tuple<asset, asset, std::optional<uint16_t>, bool, std::optional<asset>> saved;
+        const size_t messages;
+        bool committed = false;
+
+    public:
+        // the session's left as it is without one
+        explicit rollback_guard(session_state* ses):
+            ses(ses),
+            saved(ses ? decltype(saved)(ses->deposit, ses->max_win, ses->action_required, ses->random_required, ses->payout)
+                      : decltype(saved)()),
+            messages(ses ? ses->messages.size() : 0) {
+            eosio::detail::table_registry::get().begin();
+        }
+
+        rollback_guard(const rollback_guard&) = delete;
+        rollback_guard& operator=(const rollback_guard&) = delete;
+
+        void commit() {
+            eosio::detail::table_registry::get().commit();
+            committed = true;
+        }
+
+        ~rollback_guard() {
+            if (committed) {
+                return;
+            }
+            eosio::detail::table_registry::get().rollback();
+            if (!ses) {
+                return;
+            }
+            std::tie(ses->deposit, ses->max_win, ses->action_required, ses->random_required, ses->payout) = saved;
+            ses->messages.resize(messages);
+            if (!ses->payout) {
+                ses->finish_message.clear();
+            }
+        }
+    };
+
+    template <typename F>
+    void transaction(uint64_t ses_id, F&& f) {
+        auto& h = game_sdk::host::get();
+        auto& ses = h.session(ses_id);
+        h.current = ses_id;
+        eosio::console().clear();
+        rollback_guard guard(&ses);
+        const bool was_finished = ses.payout.has_value();
+        Contract c(self, self, {});
+        f(c);
+        if (!was_finished && ses.payout) {
+            c.on_finish(ses_id);
+        }
+        guard.commit();
+    }
+};
+
+} // ns native_host
@@ -0,0 +1,208 @@
+// Distribution of a round's net win, not just its mean: the side bets' distributions are exact,
+// enumerated over the initial cards with the contract's paytables; the main game's one is simulated,
+// played through the native host by a strategy. The simulated joint distribution of the main game
+// and both side bets is cached, so any sets of bets and max payouts are compared without replaying.
+//
+// Usage: payout_dist [ --games <n> ] [ --seed <s> ] [ --strategy <name> ] [ --cache <dir> ]
+//                    [ --params <ante>,<pair>,<first three>,<max payout> ]...
+// Amounts of --params are in BET, e.g. --params 100,10,0,5000; every set is reported.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+
+#include <rtp/archive.hpp>
+#include <rtp/distribution.hpp>
+
+#include "play.hpp"
+
+using namespace blackjack::simulation;
+namespace rtp = blackjack::rtp;
+
+namespace {
+
+// wins of a 1 BET main bet, pair and first three bets in one round
+using outcome_t = std::array<int64_t, 3>;
+
+struct joint_distribution {
+    std::map<outcome_t, int64_t> games;
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(games);
+    }
+};
+
+const char joint_magic[8] = {'B', 'J', 'D', 'S', 'T', 0, 0, 1};
+
+int64_t pair_win(uint8_t a, uint8_t b) {
+    return blackjack::get_pair_win({card_game::card(a), card_game::card(b)}, ante).amount;
+}
+
+int64_t first_three_win(uint8_t a, uint8_t b, uint8_t c) {
+    return blackjack::get_first_three_win({card_game::card(a), card_game::card(b)}, card_game::card(c), ante).amount;
+}
+
+// by the values of the player's two cards
+rtp::distribution exact_pair() {
+    rtp::distribution d;
+    for (int a = 0; a < 52; a++) {
+        for (int b = 0; b < 52; b++) {
+            d.add(pair_win(a, b), double(decks) / shoe_size * (decks - (a == b)) / (shoe_size - 1));
+        }
+    }
+    return d;
+}
+
+// by the values of the player's two cards and the dealer's card
+rtp::distribution exact_first_three() {
+    rtp::distribution d;
+    for (int a = 0; a < 52; a++) {
+        for (int b = 0; b < 52; b++) {
+            for (int c = 0; c < 52; c++) {
+                const double p = double(decks) / shoe_size * (decks - (a == b)) / (shoe_size - 1)
+                    * (decks - (c == a) - (c == b)) / (shoe_size - 2);
+                d.add(first_three_win(a, b, c), p);
+            }
+        }
+    }
+    return d;
+}
+
+joint_distribution simulate(strategy_t strategy, int64_t games, uint64_t seed) {
+    joint_distribution joint;
+    driver_t d(default_params, seed, eosio::name("blackjack"));
+    shoe_sampler sampler(seed);
+    for (int64_t i = 0; i < games; i++) {
+        const auto shoe = sampler.random();
+        const auto round = play(d, strategy, shoe);
+        joint.games[{round.returned - round.staked, pair_win(shoe[0], shoe[1]), first_three_win(shoe[0], shoe[1], shoe[2])}]++;
+    }
+    return joint;
+}
+
+joint_distribution load_or_simulate(const std::string& cache, const std::string& strategy, int64_t games, uint64_t seed) {
+    std::ostringstream path;
+    path << cache << "/joint_" << strategy << "_" << games << "_" << seed << ".bin";
+    if (std::ifstream(path.str())) {
+        std::cout << "cached " << path.str() << std::endl;
+        return rtp::load_file<joint_distribution>(path.str(), joint_magic);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto joint = simulate(parse_strategy(strategy), games, seed);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << games << " games simulated in " << elapsed.count() << "s" << std::endl;
+    mkdir(cache.c_str(), 0755);
+    rtp::save_file(path.str(), joint_magic, joint);
+    return joint;
+}
+
+std::string amount(int64_t a) {
+    return asset(a, core_symbol).to_string();
+}
+
+const double quantiles[] = {0.0001, 0.001, 0.01, 0.05, 0.5, 0.95, 0.99, 0.999, 0.9999};
+
+void print_stats(const rtp::distribution& d) {
+    std::cout << std::setprecision(6) << "  mean " << d.mean() / ante.amount << " x, sd " << std::sqrt(d.variance()) / ante.amount
+              << " x, skew " << d.skewness() << std::endl;
+}
+
+// outcomes in multiples of a 1 BET bet
+void print_paytable(const std::string& name, const rtp::distribution& d) {
+    std::cout << name << std::endl;
+    for (const auto& [outcome, weight] : d.outcomes()) {
+        std::cout << "  " << std::setw(6) << std::showpos << double(outcome) / ante.amount << std::noshowpos
+                  << " x  " << std::scientific << std::setprecision(6) << weight / d.total() << std::defaultfloat << std::endl;
+    }
+    print_stats(d);
+}
+
+struct param_set {
+    int64_t ante = 0, pair = 0, first_three = 0, max_payout = 0;
+};
+
+param_set parse_params(const std::string& s) {
+    param_set p;
+    char sep[3];
+    double v[4];
+    std::istringstream in(s);
+    in >> v[0] >> sep[0] >> v[1] >> sep[1] >> v[2] >> sep[2] >> v[3];
+    if (!in || sep[0] != ',' || sep[1] != ',' || sep[2] != ',') {
+        throw std::invalid_argument("--params expects <ante>,<pair>,<first three>,<max payout>: " + s);
+    }
+    p.ante = std::llround(v[0] * ante.amount);
+    p.pair = std::llround(v[1] * ante.amount);
+    p.first_three = std::llround(v[2] * ante.amount);
+    p.max_payout = std::llround(v[3] * ante.amount);
+    return p;
+}
+
+void print_round(const joint_distribution& joint, const param_set& p) {
+    rtp::distribution uncapped;
+    for (const auto& [o, games] : joint.games) {
+        uncapped.add((p.ante * o[0] + p.pair * o[1] + p.first_three * o[2]) / ante.amount, games);
+    }
+    const auto d = uncapped.capped(p.max_payout);
+    std::cout << "ante " << amount(p.ante) << ", pair " << amount(p.pair) << ", first three " << amount(p.first_three)
+              << ", max payout " << amount(p.max_payout) << std::endl;
+    std::cout << "  mean " << amount(std::llround(d.mean())) << ", sd " << amount(std::llround(std::sqrt(d.variance())))
+              << ", skew " << std::setprecision(4) << d.skewness() << std::endl;
+    for (const auto q : quantiles) {
+        std::cout << "  q" << std::setw(7) << std::left << q << std::right << " " << amount(d.quantile(q)) << std::endl;
+    }
+    std::cout << "  max win " << amount(uncapped.outcomes().rbegin()->first) << ", P(win > max payout) "
+              << uncapped.tail(p.max_payout) << ", cut per round " << amount(std::llround(uncapped.mean() - d.mean())) << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    int64_t games = 1'000'000;
+    uint64_t seed = 0;
+    std::string strategy = "optimal";
+    std::string cache = ".payout_dist";
+    std::vector<param_set> param_sets;
+    try {
+        for (int i = 1; i + 1 < argc; i += 2) {
+            const std::string arg = argv[i];
+            if (arg == "--games") {
+                games = std::atoll(argv[i + 1]);
+            } else if (arg == "--seed") {
+                seed = std::strtoull(argv[i + 1], nullptr, 10);
+            } else if (arg == "--strategy") {
+                strategy = argv[i + 1];
+                parse_strategy(strategy);
+            } else if (arg == "--cache") {
+                cache = argv[i + 1];
+            } else if (arg == "--params") {
+                param_sets.push_back(parse_params(argv[i + 1]));
+            } else {
+                throw std::invalid_argument("unknown option: " + arg);
+            }
+        }
+        if (argc % 2 == 0) {
+            throw std::invalid_argument(std::string("missing value of ") + argv[argc - 1]);
+        }
+
+        const auto joint = load_or_simulate(cache, strategy, games, seed);
+        rtp::distribution main_game;
+        for (const auto& [o, n] : joint.games) {
+            main_game.add(o[0], n);
+        }
+        print_paytable("main game, simulated", main_game);
+        print_paytable("pair, exact", exact_pair());
+        print_paytable("first three, exact", exact_first_three());
+        for (const auto& p : param_sets) {
+            print_round(joint, p);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <array>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <blackjack/blackjack.hpp>
+#include <history/store.hpp>
+#include <native_host/driver.hpp>
+#include <rtp/estimator.hpp>
+#include <strategy/strategy.hpp>
+
+// Games of the simulation tools: shoes scripted by the tool and played through the native host
+// by a strategy, one box per session.
+namespace blackjack { namespace simulation {
+
+using eosio::asset;
+using game_sdk::param_t;
+
+using driver_t = native_host::driver<blackjack>;
+using shoe_t = std::vector<uint8_t>;
+
+const eosio::symbol core_symbol{"BET", 4};
+const asset ante{1'0000, core_symbol};
+
+const std::map<uint16_t, param_t> default_params = {
+    {param::min_ante, 1'0000},
+    {param::max_ante, 10'000'0000},
+    {param::max_payout, 100'000'0000},
+    {param::max_pair, 3'000'0000},
+    {param::max_first_three, 1'000'0000},
+};
+
+// enough for any single box game, cards past the script are drawn by the contract
+const int script_size = 40;
+
+// ---------------------------------------------------------------------------------------------
+// shoes
+
+const int decks = 8;
+const int shoe_size = 52 * decks;
+
+// 2..9, ten valued cards and aces
+const int rank_classes = 10;
+
+inline int rank_class(int value) {
+    const int rank = value / 4;
+    return rank < 8 ? rank : rank < 12 ? 8 : 9;
+}
+
+// copies of every card value left in the shoe
+struct shoe_counts {
+    std::array<int, 52> copies;
+    int left = shoe_size;
+
+    shoe_counts() {
+        copies.fill(decks);
+    }
+
+    int take(int value) {
+        copies[value]--;
+        left--;
+        return value;
+    }
+
+    // u in [0, 1) picks a card among the ones left
+    int draw(double u) {
+        int idx = std::min(int(u * left), left - 1);
+        for (int value = 0; value < 52; value++) {
+            if (idx < copies[value]) {
+                return take(value);
+            }
+            idx -= copies[value];
+        }
+        throw std::logic_error("shoe is exhausted");
+    }
+
+    // a card of the rank class, weighted by the copies left
+    int draw(int cls, double u) {
+        int in_class = 0;
+        for (int v = 0; v < 52; v++) {
+            in_class += rank_class(v) == cls ? copies[v] : 0;
+        }
+        int idx = std::min(int(u * in_class), in_class - 1);
+        for (int v = 0; v < 52; v++) {
+            if (rank_class(v) != cls) {
+                continue;
+            }
+            if (idx < copies[v]) {
+                return take(v);
+            }
+            idx -= copies[v];
+        }
+        throw std::logic_error("rank class is exhausted");
+    }
+};
+
+class shoe_sampler {
+public:
+    explicit shoe_sampler(uint64_t seed): rng(seed) {}
+
+    double uniform() {
+        return dist(rng);
+    }
+
+    shoe_t random() {
+        shoe_counts counts;
+        shoe_t shoe(script_size);
+        for (auto& c : shoe) {
+            c = counts.draw(uniform());
+        }
+        return shoe;
+    }
+
+    // a shoe dealing the initial ranks of the stratum
+    shoe_t stratified(int stratum) {
+        shoe_counts counts;
+        shoe_t shoe(script_size);
+        const int classes[] = {stratum / 100, stratum / 10 % 10, stratum % 10};
+        for (int i = 0; i < 3; i++) {
+            shoe[i] = counts.draw(classes[i], uniform());
+        }
+        for (int i = 3; i < script_size; i++) {
+            shoe[i] = counts.draw(uniform());
+        }
+        return shoe;
+    }
+
+private:
+    std::mt19937_64 rng;
+    std::uniform_real_distribution<double> dist;
+};
+
+// probabilities of the initial deals: player's first card, player's second card, dealer's card
+inline std::vector<double> initial_deal_weights() {
+    std::vector<double> weights(rank_classes * rank_classes * rank_classes);
+    const auto copies = [](int cls) { return double(cls == 8 ? 16 * decks : 4 * decks); };
+    for (int a = 0; a < rank_classes; a++) {
+        for (int b = 0; b < rank_classes; b++) {
+            for (int c = 0; c < rank_classes; c++) {
+                weights[(a * 10 + b) * 10 + c] = copies(a) / shoe_size
+                    * (copies(b) - (b == a)) / (shoe_size - 1)
+                    * (copies(c) - (c == a) - (c == b)) / (shoe_size - 2);
+            }
+        }
+    }
+    return weights;
+}
+
+// ---------------------------------------------------------------------------------------------
+// games
+
+enum class strategy_t { optimal, no_double, no_split, dealer };
+
+inline strategy_t parse_strategy(const std::string& name) {
+    if (name == "optimal") return strategy_t::optimal;
+    if (name == "no_double") return strategy_t::no_double;
+    if (name == "no_split") return strategy_t::no_split;
+    if (name == "dealer") return strategy_t::dealer;
+    throw std::invalid_argument("unknown strategy: " + name);
+}
+
+inline uint8_t decide(strategy_t s, const blackjack::state_row& state) {
+    const auto& box = state.active();
+    const bool can_split = !box.has_split() && s != strategy_t::no_split;
+    if (s == strategy_t::dealer) {
+        return card_game::get_weight(box.active_cards) < 17 ? strategy::hit : strategy::stand;
+    }
+    const auto d = strategy::decide(box.active_cards, state.dealer_card, can_split);
+    return s == strategy_t::no_double && d == strategy::double_down ? strategy::hit : d;
+}
+
+// amounts of a box's bets, the session's deposit is their sum
+struct box_bet {
+    asset ante = simulation::ante;
+    asset pair{0, core_symbol};
+    asset first_three{0, core_symbol};
+
+    asset total() const {
+        return ante + pair + first_three;
+    }
+};
+
+// follows a box's cards for the hand history. The state row is gone once the game finishes,
+// so the cards dealt by the last transaction are taken from the game_finished message
+class hand_tracker {
+public:
+    // before every decision
+    void before(const blackjack::state_row& row, uint8_t decision) {
+        box = row.active();
+        up = row.dealer_card;
+        doubled |= decision == strategy::double_down;
+        last_decision = decision;
+    }
+
+    history::hand_record finish(const game_sdk::session_state& ses, const box_bet& bet) const {
+        const auto& words = ses.finish_message;
+        auto [player_cards, dealer_cards] =
+            message::reader(reinterpret_cast<const uint8_t*>(words.data()), words.size() * sizeof(words[0])).decode();
+        history::hand_record r;
+        r.first_hand = box.active_cards;
+        r.second_hand = box.split_cards;
+        if (last_decision == strategy::split) {
+            // the pair is split before the two new cards are dealt
+            r.second_hand.push_back(r.first_hand.back());
+            r.first_hand.pop_back();
+            r.first_hand.push_back(player_cards[0]);
+            r.second_hand.push_back(player_cards[1]);
+        } else {
+            r.first_hand.insert(r.first_hand.end(), player_cards.begin(), player_cards.end());
+        }
+        // but for a blackjack on the deal, the dealer's cards of the message are drawn after the up card
+        if (last_decision) {
+            dealer_cards.insert(dealer_cards.begin(), up);
+        }
+        r.dealer_cards = std::move(dealer_cards);
+        r.doubled = doubled;
+        r.ante = bet.ante.amount;
+        r.pair = bet.pair.amount;
+        r.first_three = bet.first_three.amount;
+        r.staked = ses.deposit.amount;
+        r.payout = ses.payout->amount;
+        return r;
+    }
+
+private:
+    blackjack::box_state box;
+    card_game::card up;
+    bool doubled = false;
+    std::optional<uint8_t> last_decision;
+};
+
+// plays a game of one box on the scripted shoe, returns its payout and all that was staked
+inline rtp::sample play(driver_t& d, strategy_t s, const shoe_t& shoe, const box_bet& bet = {}) {
+    blackjack::state_table states(d.get_self(), d.get_self().value);
+    const auto ses_id = d.new_game(bet.total());
+    d.action(ses_id, action::bet, {param_t(bet.ante.amount), param_t(bet.pair.amount), param_t(bet.first_three.amount)});
+    d.call(ses_id, [&](blackjack& c) { c.pushshoe(ses_id, shoe); });
+    d.random(ses_id);
+    while (!d.finished(ses_id)) {
+        const auto& state = states.get(ses_id);
+        const auto decision = decide(s, state);
+        const bool raise = decision == strategy::double_down || decision == strategy::split;
+        d.action(ses_id, action::play, {decision}, raise ? bet.ante : asset());
+        // a stand that moves play to the next hand doesn't require a random
+        if (d.session(ses_id).random_required) {
+            d.random(ses_id);
+        }
+    }
+    const auto& ses = d.session(ses_id);
+    const rtp::sample result{ses.payout->amount, ses.deposit.amount};
+    // finished sessions aren't needed anymore, millions of them would only take memory
+    game_sdk::host::get().sessions.erase(ses_id);
+    return result;
+}
+
+}} // ns blackjack::simulation
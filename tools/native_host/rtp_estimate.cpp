@@ -0,0 +1,167 @@
+// Estimates the RTP of the contract played in-process, with variance reduction:
+//   plain      - independent random shoes
+//   stratified - over the initial deal, i.e. ranks of the player's two cards and of the dealer's card,
+//                with exact stratum probabilities and Neyman allocation of games
+// Shoes are scripted with the debug pushshoe action, so a game's cards are chosen by the estimator.
+// With --compare two strategies play the same shoes (common random numbers) and the difference
+// of their RTPs is reported. Sampling stops once the 95% confidence half-width reaches the target.
+// With --out the result is written to a file after every batch: a run can be split into shards
+// of the same seed run by separate processes, a shard resumes from its file, and rtp_merge
+// combines the files.
+//
+// Usage: rtp_estimate [ --mode plain|stratified ] [ --strategy <name> ] [ --compare <name> ]
+//                     [ --half-width <w> ] [ --max-games <n> ] [ --batch <n> ] [ --seed <s> ]
+//                     [ --shard <n> --out <file> ]
+// Strategies: optimal, no_double, no_split, dealer (hits below 17)
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include <rtp/shard.hpp>
+
+#include "play.hpp"
+
+using namespace blackjack::simulation;
+namespace rtp = blackjack::rtp;
+
+namespace {
+
+struct options {
+    rtp::run_config run{"plain", "optimal", "", 0, 20'000};
+    double half_width = 0.002;
+    int64_t max_games = 20'000'000;
+    uint32_t shard = 0;
+    // shard result file, also the checkpoint the shard resumes from
+    std::string out;
+};
+
+const char* usage =
+    "Usage: rtp_estimate [ --mode plain|stratified ] [ --strategy <name> ] [ --compare <name> ]\n"
+    "                    [ --half-width <w> ] [ --max-games <n> ] [ --batch <n> ] [ --seed <s> ]\n"
+    "                    [ --shard <n> --out <file> ]\n"
+    "Strategies: optimal, no_double, no_split, dealer (hits below 17)\n";
+
+options parse_options(int argc, char** argv) {
+    options o;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h") {
+            std::cout << usage;
+            std::exit(EXIT_SUCCESS);
+        }
+        if (i + 1 == argc) {
+            throw std::invalid_argument("missing value of " + arg);
+        }
+        const char* value = argv[++i];
+        if (arg == "--mode") {
+            o.run.mode = value;
+        } else if (arg == "--strategy") {
+            o.run.strategy = value;
+        } else if (arg == "--compare") {
+            o.run.compare = value;
+        } else if (arg == "--half-width") {
+            o.half_width = std::atof(value);
+        } else if (arg == "--max-games") {
+            o.max_games = std::atoll(value);
+        } else if (arg == "--batch") {
+            o.run.batch = std::atoll(value);
+        } else if (arg == "--seed") {
+            o.run.seed = std::strtoull(value, nullptr, 10);
+        } else if (arg == "--shard") {
+            o.shard = std::strtoul(value, nullptr, 10);
+        } else if (arg == "--out") {
+            o.out = value;
+        } else {
+            throw std::invalid_argument("unknown option: " + arg);
+        }
+    }
+    if (o.run.mode != "plain" && o.run.mode != "stratified") {
+        throw std::invalid_argument("unknown mode: " + o.run.mode);
+    }
+    parse_strategy(o.run.strategy);
+    if (!o.run.compare.empty()) {
+        parse_strategy(o.run.compare);
+        if (o.run.mode == "stratified") {
+            throw std::invalid_argument("--compare works with the plain mode");
+        }
+    }
+    return o;
+}
+
+uint64_t splitmix64(uint64_t x) {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+}
+
+// a batch depends only on the run's seed, the shard, its index and the result so far,
+// so a resumed shard plays the same games as one that never stopped
+void run_batch(const options& o, rtp::shard_result& r) {
+    const uint64_t seed = splitmix64(splitmix64(splitmix64(o.run.seed) ^ o.shard) ^ r.batches);
+    driver_t d(default_params, seed, eosio::name("blackjack"));
+    shoe_sampler sampler(seed);
+    const auto strategy = parse_strategy(o.run.strategy);
+
+    if (r.is_stratified()) {
+        const auto counts = r.stratified.allocate(o.run.batch, [&] { return sampler.uniform(); });
+        for (size_t h = 0; h < counts.size(); h++) {
+            for (int64_t i = 0; i < counts[h]; i++) {
+                r.stratified.add(h, play(d, strategy, sampler.stratified(h)));
+                r.games++;
+            }
+        }
+        return;
+    }
+
+    // a shoe is played by every strategy
+    for (int64_t i = 0; i < o.run.batch; i++) {
+        const auto shoe = sampler.random();
+        const auto a = play(d, strategy, shoe);
+        if (r.is_paired()) {
+            r.paired.add(a, play(d, parse_strategy(o.run.compare), shoe));
+        } else {
+            r.plain.add(a);
+        }
+        r.games++;
+    }
+}
+
+void estimate(const options& o) {
+    rtp::shard_result r;
+    if (!o.out.empty() && std::ifstream(o.out)) {
+        r = rtp::load(o.out);
+        if (r.config != o.run || r.shards != std::vector<uint32_t>{o.shard}) {
+            throw std::runtime_error(o.out + " is a result of another run or shard");
+        }
+        std::cout << "resuming after batch #" << r.batches << std::endl;
+    } else {
+        r.config = o.run;
+        r.shards = {o.shard};
+        if (r.is_stratified()) {
+            r.stratified = rtp::stratified_estimator(initial_deal_weights());
+        }
+    }
+    while (r.games < o.max_games && r.half_width() > o.half_width) {
+        run_batch(o, r);
+        r.batches++;
+        if (!o.out.empty()) {
+            rtp::save(o.out, r);
+        }
+    }
+    rtp::print(std::cout, r);
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    try {
+        estimate(parse_options(argc, argv));
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,284 @@
+// Runs game scenarios against the contract sources in-process:
+// scripted games with known outcomes (debug builds only) and a batch of random games
+// played by the optimal strategy, which checks the contract's invariants and reports the RTP,
+// sessions stalled in every state, found through the state table's bystate index, and games of random boxes,
+// side bets and legal decisions whose win never exceeds any max win reserved on the way.
+// The random games are appended to a hand history segment if one is given.
+//
+// Usage: native_scenarios [ <games> [ <seed> [ <hand history segment> ] ] ]
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+
+#include <blackjack/blackjack.hpp>
+#include <history/store.hpp>
+#include <native_host/driver.hpp>
+#include <strategy/strategy.hpp>
+
+#include "play.hpp"
+
+using blackjack::cards_t;
+using eosio::asset;
+using game_sdk::param_t;
+
+namespace {
+
+using driver_t = native_host::driver<blackjack::blackjack>;
+
+const eosio::symbol core_symbol{"BET", 4};
+const asset ante{1'0000, core_symbol};
+
+const std::map<uint16_t, param_t> params = {
+    {blackjack::param::min_ante, 1'0000},
+    {blackjack::param::max_ante, 10'000'0000},
+    {blackjack::param::max_payout, 100'000'0000},
+    {blackjack::param::max_pair, 3'000'0000},
+    {blackjack::param::max_first_three, 1'000'0000},
+};
+
+int failures = 0;
+
+void fail(const std::string& what) {
+    std::cerr << "FAILED: " << what << std::endl;
+    failures++;
+}
+
+const blackjack::blackjack::state_row* get_state(const driver_t& d, uint64_t ses_id) {
+    blackjack::blackjack::state_table state(d.get_self(), d.get_self().value);
+    const auto it = state.find(ses_id);
+    return it != state.end() ? &*it : nullptr;
+}
+
+asset active_ante(const driver_t& d, uint64_t ses_id) {
+    blackjack::blackjack::bet_table bet(d.get_self(), d.get_self().value);
+    return bet.get(ses_id).boxes[get_state(d, ses_id)->active_box].ante;
+}
+
+void decide(driver_t& d, uint64_t ses_id, char decision) {
+    switch (decision) {
+        case 'H': d.action(ses_id, blackjack::action::play, {blackjack::decision::hit}); break;
+        case 'S': d.action(ses_id, blackjack::action::play, {blackjack::decision::stand}); break;
+        case 'D': d.action(ses_id, blackjack::action::play, {blackjack::decision::double_down}, active_ante(d, ses_id)); break;
+        case 'P': d.action(ses_id, blackjack::action::play, {blackjack::decision::split}, active_ante(d, ses_id)); break;
+        default: throw std::logic_error("unknown decision");
+    }
+    // a stand that moves play to the next hand doesn't require a random
+    if (d.session(ses_id).random_required) {
+        d.random(ses_id);
+    }
+}
+
+// player's win over the staked amount
+int64_t win(const driver_t& d, uint64_t ses_id) {
+    const auto& ses = d.session(ses_id);
+    return ses.payout->amount - ses.deposit.amount;
+}
+
+#ifdef IS_DEBUG
+struct scripted_game {
+    const char* name;
+    cards_t shoe;
+    std::string decisions;
+    int64_t win;
+};
+
+void run_scripted_games(driver_t& d) {
+    const std::vector<scripted_game> games = {
+        {"player has a blackjack", {"Ad", "Ts", "2c", "7c"}, "", 1'5000},
+        {"stand and win", {"Kd", "9s", "Td", "8c"}, "S", 1'0000},
+        {"hit two times and win", {"Kd", "5s", "Td", "4s", "Ad", "5c", "4d"}, "HHS", 1'0000},
+        {"double and win", {"6d", "5s", "Td", "8s", "7d"}, "D", 2'0000},
+        {"split win win", {"6d", "6s", "Td", "8s", "Kh", "5h", "4c", "2c", "6h"}, "PHSHS", 2'0000},
+        {"split double lose win", {"6d", "6s", "Td", "5s", "Kh", "4h", "4c", "9h"}, "PDHS", -1'0000},
+        {"split aces", {"Ad", "As", "Td", "9s", "Ac", "Qd"}, "P", -1'0000},
+    };
+    for (const auto& g : games) {
+        const auto ses_id = d.new_game(ante);
+        d.action(ses_id, blackjack::action::bet, {param_t(ante.amount), 0, 0});
+        std::vector<uint8_t> ids;
+        for (const auto& c : g.shoe) {
+            ids.push_back(c.get_value());
+        }
+        d.call(ses_id, [&](blackjack::blackjack& c) { c.pushshoe(ses_id, ids); });
+        d.random(ses_id);
+        for (const char decision : g.decisions) {
+            decide(d, ses_id, decision);
+        }
+        if (!d.finished(ses_id)) {
+            fail(std::string(g.name) + ": game isn't finished");
+        } else if (win(d, ses_id) != g.win) {
+            fail(std::string(g.name) + ": win " + std::to_string(win(d, ses_id)) + ", expected " + std::to_string(g.win));
+        }
+    }
+    std::cout << games.size() << " scripted games played" << std::endl;
+}
+#endif
+
+// one transaction of a session: a bet, a random or the optimal decision
+void step(driver_t& d, uint64_t ses_id) {
+    const auto& ses = d.session(ses_id);
+    if (ses.action_required == blackjack::action::bet) {
+        d.action(ses_id, blackjack::action::bet, {param_t(ante.amount), 0, 0});
+    } else if (ses.random_required) {
+        d.random(ses_id);
+    } else {
+        const auto& state = *get_state(d, ses_id);
+        const auto& box = state.active();
+        const auto choice = blackjack::strategy::decide(box.active_cards, state.dealer_card, !box.has_split());
+        const bool raise = choice == blackjack::decision::double_down || choice == blackjack::decision::split;
+        d.action(ses_id, blackjack::action::play, {choice}, raise ? active_ante(d, ses_id) : asset());
+    }
+}
+
+// sessions left in every state, some of them after a rejected action, are found by a range scan
+// of the bystate index exactly as by a full scan of the table
+void run_stalled_sessions(driver_t& d, uint64_t seed) {
+    using state_row = blackjack::blackjack::state_row;
+    std::mt19937_64 rng(seed);
+    for (int i = 0; i < 10000; i++) {
+        const auto ses_id = d.new_game(ante);
+        for (int steps = rng() % 8; steps > 0 && !d.finished(ses_id); steps--) {
+            step(d, ses_id);
+        }
+        if (!d.finished(ses_id) && rng() % 4 == 0) {
+            try {
+                d.action(ses_id, blackjack::action::play, {blackjack::decision::split}, ante);
+            } catch (const eosio::check_failure&) {
+            }
+        }
+    }
+
+    blackjack::blackjack::state_table state(d.get_self(), d.get_self().value);
+    std::map<uint16_t, std::vector<uint64_t>> scanned;
+    for (const auto& row : state) {
+        scanned[row.state].push_back(row.ses_id);
+    }
+    const auto by_state = state.get_index<"bystate"_n>();
+    std::cout << "stalled sessions by state:";
+    for (uint16_t s = 0; s < blackjack::fsm::finished; s++) {
+        std::vector<uint64_t> found;
+        const auto end = by_state.lower_bound(state_row::state_key(s + 1, 0));
+        for (auto it = by_state.lower_bound(state_row::state_key(s, 0)); it != end; ++it) {
+            found.push_back(it->ses_id);
+        }
+        if (found != scanned[s]) {
+            fail("bystate index doesn't match the table in state " + std::to_string(s));
+        }
+        std::cout << " " << s << ":" << found.size();
+    }
+    std::cout << std::endl;
+}
+
+// the reservation property: the player's win over the stakes is never above the max win of any state
+// the game's been through, whatever the boxes, side bets and legal decisions
+void run_reserve_property(driver_t& d, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    const int games = 20000;
+    for (int i = 0; i < games; i++) {
+        std::vector<param_t> bets;
+        int64_t deposit = 0;
+        for (int boxes = 1 + rng() % blackjack::max_boxes; boxes > 0; boxes--) {
+            const param_t pair = rng() % 2 ? ante.amount : 0, first_three = rng() % 2 ? ante.amount : 0;
+            bets.insert(bets.end(), {param_t(10 * ante.amount), pair, first_three});
+            deposit += 10 * ante.amount + pair + first_three;
+        }
+        const auto ses_id = d.new_game(asset(deposit, core_symbol));
+        d.action(ses_id, blackjack::action::bet, bets);
+        asset min_reserved = get_state(d, ses_id)->max_player_win;
+        d.random(ses_id);
+        while (!d.finished(ses_id)) {
+            const auto& state = *get_state(d, ses_id);
+            min_reserved = std::min(min_reserved, state.max_player_win);
+            const auto& box = state.active();
+            const auto w = card_game::get_weight(box.active_cards);
+            std::vector<char> decisions{'H', 'S'};
+            if (box.active_cards.size() == 2 && 9 <= w && w <= 11 && card_game::is_hard(box.active_cards)) {
+                decisions.push_back('D');
+            }
+            if (box.active_cards.size() == 2 && !box.has_split()
+                && card_game::get_weight(box.active_cards[0]) == card_game::get_weight(box.active_cards[1])) {
+                decisions.push_back('P');
+            }
+            try {
+                decide(d, ses_id, decisions[rng() % decisions.size()]);
+            } catch (const eosio::check_failure& e) {
+                // the host refuses a payout over the session's max win
+                fail("session " + std::to_string(ses_id) + ": " + e.what());
+                break;
+            }
+            if (const auto next = get_state(d, ses_id)) {
+                min_reserved = std::min(min_reserved, next->max_player_win);
+            }
+        }
+        if (d.finished(ses_id) && win(d, ses_id) > min_reserved.amount) {
+            fail("session " + std::to_string(ses_id) + " won " + std::to_string(win(d, ses_id))
+                 + " over a reservation of " + std::to_string(min_reserved.amount));
+        }
+    }
+    std::cout << games << " games checked against their reservations" << std::endl;
+}
+
+void run_random_games(driver_t& d, int games, blackjack::history::writer* history) {
+    int64_t staked = 0, paid = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < games; i++) {
+        const auto ses_id = d.new_game(ante);
+        d.action(ses_id, blackjack::action::bet, {param_t(ante.amount), 0, 0});
+        d.random(ses_id);
+        blackjack::simulation::hand_tracker hand;
+        while (!d.finished(ses_id)) {
+            const auto& state = *get_state(d, ses_id);
+            const auto& box = state.active();
+            const auto choice = blackjack::strategy::decide(box.active_cards, state.dealer_card, !box.has_split());
+            hand.before(state, choice);
+            decide(d, ses_id, "HSPD"[choice]);
+        }
+        const auto& ses = d.session(ses_id);
+        if (history) {
+            history->append(hand.finish(ses, {ante}));
+        }
+        if (ses.payout->amount < 0) {
+            fail("negative payout in session " + std::to_string(ses_id));
+        }
+        if (get_state(d, ses_id) != nullptr) {
+            fail("state row of finished session " + std::to_string(ses_id) + " is left");
+        }
+        staked += ses.deposit.amount;
+        paid += ses.payout->amount;
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    std::cout << games << " random games played in " << elapsed.count() << "s, RTP "
+              << (staked ? double(paid) / staked : 0.) << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    const int games = argc > 1 ? std::atoi(argv[1]) : 100000;
+    const uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 0;
+    std::unique_ptr<blackjack::history::writer> history;
+    if (argc > 3) {
+        history = std::make_unique<blackjack::history::writer>(argv[3]);
+    }
+
+    driver_t d(params, seed, eosio::name("blackjack"));
+    try {
+#ifdef IS_DEBUG
+        run_scripted_games(d);
+        d.reset(params);
+#endif
+        run_stalled_sessions(d, seed);
+        d.reset(params);
+        run_reserve_property(d, seed);
+        d.reset(params);
+        run_random_games(d, games, history.get());
+    } catch (const eosio::check_failure& e) {
+        fail(std::string("check failed: ") + e.what());
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,296 @@
+// Compares the two ways the contract makes its shoe: rebuilt for every random from 8 decks without the session's
+// cards, and the casino's continuous shuffling machine (param::continuous_shuffle), a shoe row per casino that
+// every dealt card leaves and every finished session's cards return to. The same games are played both ways,
+// many sessions open at once and advanced in random order, and the time of the random transactions is reported
+// along with the shoe rows' writes and RAM.
+// With the machine the cards of every casino are checked to be conserved: the shoe and the open sessions' cards
+// make 8 decks after the transactions, and the shoe's full once all the games are over.
+//
+// Usage: shoe_bench [ --games <n> ] [ --seed <s> ] [ --sessions <n> ] [ --casinos <n> ] [ --boxes <max boxes> ]
+//                   [ --strategy <name> ]
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "play.hpp"
+
+using namespace blackjack::simulation;
+
+namespace {
+
+using contract = blackjack::blackjack;
+
+struct options {
+    int64_t games = 200'000;
+    uint64_t seed = 0;
+    int sessions = 100;
+    int casinos = 4;
+    int boxes = 1;
+    strategy_t strategy = strategy_t::optimal;
+};
+
+options parse_options(int argc, char** argv) {
+    options o;
+    for (int i = 1; i < argc; i += 2) {
+        const std::string arg = argv[i];
+        if (i + 1 == argc) {
+            throw std::invalid_argument("missing value of " + arg);
+        }
+        const std::string value = argv[i + 1];
+        if (arg == "--games") {
+            o.games = std::atoll(value.c_str());
+        } else if (arg == "--seed") {
+            o.seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--sessions") {
+            o.sessions = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--casinos") {
+            o.casinos = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--boxes") {
+            o.boxes = std::min<int>(std::max(1, std::atoi(value.c_str())), blackjack::max_boxes);
+        } else if (arg == "--strategy") {
+            o.strategy = parse_strategy(value);
+        } else {
+            throw std::invalid_argument("unknown option: " + arg);
+        }
+    }
+    return o;
+}
+
+struct bench_result {
+    int64_t games = 0;
+    int64_t randoms = 0;
+    int64_t actions = 0;
+    double random_seconds = 0;
+    double action_seconds = 0;
+    int64_t deposits = 0;
+    int64_t payouts = 0;
+    // rows of the casinos' shoes written: for the dealt cards and for the ones a finished game returns
+    int64_t shoe_writes = 0;
+    // the fewest cards a casino's machine had left
+    int min_left = shoe_size;
+    // draws the machine was short of cards for, the session's cards go back to it
+    // and it deals from fresh shoes for the rest of the game
+    int64_t fallbacks = 0;
+};
+
+class bench {
+public:
+    bench(const options& o, bool machine):
+        o(o), machine(machine), d(params(machine), o.seed, eosio::name("blackjack")), rng(o.seed + 1),
+        slots(o.sessions) {
+        // the param alone doesn't turn the machine on, the casinos opt in too
+        for (int casino = 0; machine && casino < o.casinos; casino++) {
+            d.call([&](contract& c) { c.setshuffle(casino, true); });
+        }
+    }
+
+    bench_result run() {
+        std::uniform_int_distribution<int> pick_slot(0, o.sessions - 1);
+        while (started < o.games || open > 0) {
+            const int i = pick_slot(rng);
+            auto& s = slots[i];
+            if (!s) {
+                if (started < o.games) {
+                    start(i);
+                }
+            } else {
+                advance(i);
+            }
+        }
+        for (int casino = 0; casino < o.casinos; casino++) {
+            if (!machine) {
+                // games without the machine don't write its rows
+                if (contract::shoe_singleton(d.get_self(), casino).exists()) {
+                    throw std::logic_error("casino " + std::to_string(casino) + "'s shoe is written without the machine");
+                }
+                continue;
+            }
+            const auto shoe = casino_shoe(casino);
+            for (const auto copies : shoe) {
+                if (copies != decks) {
+                    throw std::logic_error("casino " + std::to_string(casino) + "'s shoe isn't full after the games");
+                }
+            }
+        }
+        return r;
+    }
+
+private:
+    const options& o;
+    const bool machine;
+    driver_t d;
+    std::mt19937_64 rng;
+    // the session of every slot, a slot plays for the casino slot % casinos
+    std::vector<std::optional<uint64_t>> slots;
+    int64_t started = 0;
+    int open = 0;
+    int64_t transactions = 0;
+    bench_result r;
+
+    // the check scans the casino's open sessions, it's run every few transactions
+    static const int conservation_period = 16;
+
+    static std::map<uint16_t, param_t> params(bool machine) {
+        auto p = default_params;
+        if (machine) {
+            p[blackjack::param::continuous_shuffle] = 1;
+        }
+        return p;
+    }
+
+    uint64_t casino_of(int slot) const {
+        return slot % o.casinos;
+    }
+
+    contract::shoe_t casino_shoe(uint64_t casino_id) {
+        contract::shoe_t shoe;
+        shoe.fill(decks);
+        contract::shoe_singleton shoes(d.get_self(), casino_id);
+        if (shoes.exists()) {
+            const auto copies = shoes.get().copies;
+            std::copy(copies.begin(), copies.end(), shoe.begin());
+        }
+        return shoe;
+    }
+
+    void start(int slot) {
+        std::uniform_int_distribution<int> boxes(1, o.boxes), units(1, 5);
+        std::vector<param_t> bets;
+        int64_t deposit = 0;
+        for (int i = boxes(rng); i > 0; i--) {
+            bets.insert(bets.end(), {param_t(units(rng) * ante.amount), 0, 0});
+            deposit += bets[bets.size() - 3];
+        }
+        const auto ses_id = d.new_game(asset(deposit, core_symbol), casino_of(slot));
+        slots[slot] = ses_id;
+        started++;
+        open++;
+        act(slot, blackjack::action::bet, bets, asset());
+    }
+
+    void advance(int slot) {
+        const auto ses_id = *slots[slot];
+        contract::state_table states(d.get_self(), d.get_self().value);
+        if (d.session(ses_id).random_required) {
+            // every random but the stand's deals cards, they're written off the casino's shoe
+            r.shoe_writes += machine && states.get(ses_id).state != blackjack::fsm::game_state::stand;
+            if (machine) {
+                const int left = contract::cards_left(casino_shoe(casino_of(slot)));
+                r.min_left = std::min(r.min_left, left);
+                r.fallbacks += !detached(ses_id) && left < contract::cards_reserved(states.get(ses_id).boxes.size());
+            }
+            const auto start = std::chrono::steady_clock::now();
+            d.random(ses_id);
+            r.random_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            r.randoms++;
+            finish_if_over(slot);
+            return;
+        }
+        const auto& state = states.get(ses_id);
+        const auto decision = decide(o.strategy, state);
+        const bool raise = decision == blackjack::strategy::double_down || decision == blackjack::strategy::split;
+        act(slot, blackjack::action::play, {decision}, raise ? state.active().ante : asset());
+    }
+
+    void act(int slot, uint16_t type, const std::vector<param_t>& params, asset deposit) {
+        const auto start = std::chrono::steady_clock::now();
+        d.action(*slots[slot], type, params, deposit);
+        r.action_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        r.actions++;
+        finish_if_over(slot);
+    }
+
+    void finish_if_over(int slot) {
+        const auto ses_id = *slots[slot];
+        if (machine && ++transactions % conservation_period == 0) {
+            check_conserved(casino_of(slot));
+        }
+        const auto& ses = d.session(ses_id);
+        if (!ses.payout) {
+            return;
+        }
+        r.games++;
+        r.shoe_writes += machine;
+        r.deposits += ses.deposit.amount;
+        r.payouts += ses.payout->amount;
+        game_sdk::host::get().sessions.erase(ses_id);
+        slots[slot].reset();
+        open--;
+    }
+
+    bool detached(uint64_t ses_id) {
+        contract::detached_table detached(d.get_self(), d.get_self().value);
+        return detached.find(ses_id) != detached.end();
+    }
+
+    // the casino's shoe and the cards of its open sessions that deal from it make 8 decks
+    void check_conserved(uint64_t casino_id) {
+        auto shoe = casino_shoe(casino_id);
+        std::array<int, 52> copies;
+        std::copy(shoe.begin(), shoe.end(), copies.begin());
+        contract::state_table states(d.get_self(), d.get_self().value);
+        const auto count = [&](const blackjack::cards_t& cards) {
+            for (const auto& c : cards) {
+                copies[c.get_value()]++;
+            }
+        };
+        for (size_t slot = casino_id; slot < slots.size(); slot += o.casinos) {
+            const auto it = slots[slot] ? states.find(*slots[slot]) : states.end();
+            if (it == states.end() || detached(it->ses_id)) {
+                continue;
+            }
+            for (const auto& box : it->boxes) {
+                count(box.active_cards);
+                count(box.split_cards);
+            }
+            if (it->dealer_card) {
+                count({it->dealer_card});
+            }
+        }
+        for (const auto c : copies) {
+            if (c != decks) {
+                throw std::logic_error("cards of casino " + std::to_string(casino_id) + " aren't conserved");
+            }
+        }
+    }
+};
+
+void report(const char* name, const bench_result& r, const options& o, bool machine) {
+    std::cout << name << ": " << r.games << " games, RTP " << std::setprecision(4)
+              << double(r.payouts) / r.deposits << std::setprecision(3)
+              << ", random " << 1e6 * r.random_seconds / r.randoms << " us/tx"
+              << ", action " << 1e6 * r.action_seconds / r.actions << " us/tx"
+              << ", " << double(r.randoms) / r.games << " randoms/game";
+    if (machine) {
+        // a row of a vector of 52 copies: the size varint and the bytes, plus the chain's per row overhead
+        const int row_bytes = 1 + 52 + 112;
+        std::cout << ", " << double(r.shoe_writes) / r.games << " shoe writes/game"
+                  << ", " << o.casinos * row_bytes << " bytes of shoe rows (" << row_bytes << " per casino)"
+                  << ", min " << r.min_left << " cards left, " << r.fallbacks << " sessions detached to fresh shoes";
+    }
+    std::cout << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    try {
+        const auto o = parse_options(argc, argv);
+        const auto rebuilt = bench(o, false).run();
+        report("rebuilt shoe", rebuilt, o, false);
+        const auto machine = bench(o, true).run();
+        report("continuous shuffle", machine, o, true);
+        std::cout << "random tx time x" << std::setprecision(3)
+                  << (machine.random_seconds / machine.randoms) / (rebuilt.random_seconds / rebuilt.randoms)
+                  << " with the machine" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        std::cerr << "Usage: shoe_bench [ --games <n> ] [ --seed <s> ] [ --sessions <n> ] [ --casinos <n> ]"
+                     " [ --boxes <max boxes> ] [ --strategy <name> ]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
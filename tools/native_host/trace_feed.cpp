@@ -0,0 +1,178 @@
+// Stand-in for a node's trace feed: plays games through the native host with many sessions open at once,
+// advancing a random one by a transaction the way they interleave on chain, and writes the player's actions
+// and the game's message and game_finished events as a trace dump to stdout, see tools/trace/event.hpp.
+//
+// Usage: trace_feed [ --games <n> ] [ --seed <s> ] [ --sessions <n> ] [ --boxes <max boxes> ] [ --side-bets <0|1> ]
+//                   [ --strategy <name> ]
+// e.g. trace_feed --games 100000 | trace_decode -
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <trace/event.hpp>
+
+#include "play.hpp"
+
+using namespace blackjack::simulation;
+namespace trace = blackjack::trace;
+
+namespace {
+
+struct options {
+    int64_t games = 100'000;
+    uint64_t seed = 0;
+    int sessions = 1000;
+    int boxes = 1;
+    bool side_bets = false;
+    strategy_t strategy = strategy_t::optimal;
+};
+
+options parse_options(int argc, char** argv) {
+    options o;
+    for (int i = 1; i < argc; i += 2) {
+        const std::string arg = argv[i];
+        if (i + 1 == argc) {
+            throw std::invalid_argument("missing value of " + arg);
+        }
+        const std::string value = argv[i + 1];
+        if (arg == "--games") {
+            o.games = std::atoll(value.c_str());
+        } else if (arg == "--seed") {
+            o.seed = std::strtoull(value.c_str(), nullptr, 10);
+        } else if (arg == "--sessions") {
+            o.sessions = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--boxes") {
+            o.boxes = std::min<int>(std::max(1, std::atoi(value.c_str())), blackjack::max_boxes);
+        } else if (arg == "--side-bets") {
+            o.side_bets = std::atoi(value.c_str()) != 0;
+        } else if (arg == "--strategy") {
+            o.strategy = parse_strategy(value);
+        } else {
+            throw std::invalid_argument("unknown option: " + arg);
+        }
+    }
+    return o;
+}
+
+class feed {
+public:
+    explicit feed(const options& o):
+        o(o), d(default_params, o.seed, eosio::name("blackjack")), rng(o.seed + 1), slots(o.sessions) {}
+
+    void run(std::ostream& os) {
+        std::uniform_int_distribution<int> pick_slot(0, o.sessions - 1);
+        while (started < o.games || open > 0) {
+            auto& s = slots[pick_slot(rng)];
+            if (!s.ses_id) {
+                if (started < o.games) {
+                    start(s, os);
+                }
+            } else {
+                advance(s, os);
+            }
+        }
+    }
+
+private:
+    struct slot {
+        std::optional<uint64_t> ses_id;
+        size_t messages = 0;
+    };
+
+    const options& o;
+    driver_t d;
+    std::mt19937_64 rng;
+    std::vector<slot> slots;
+    int64_t started = 0;
+    int open = 0;
+    trace::event e;
+
+    void start(slot& s, std::ostream& os) {
+        std::uniform_int_distribution<int> boxes(1, o.boxes), units(1, 5), side(0, 1);
+        std::vector<param_t> bets;
+        int64_t deposit = 0;
+        for (int i = boxes(rng); i > 0; i--) {
+            bets.push_back(units(rng) * ante.amount);
+            bets.push_back(o.side_bets ? side(rng) * ante.amount : 0);
+            bets.push_back(o.side_bets ? side(rng) * ante.amount : 0);
+            deposit += bets[bets.size() - 3] + bets[bets.size() - 2] + bets[bets.size() - 1];
+        }
+        const auto ses_id = d.new_game(asset(deposit, core_symbol));
+        started++;
+        open++;
+        s.ses_id = ses_id;
+        s.messages = 0;
+        e = {};
+        e.ses_id = ses_id;
+        e.kind = trace::event_kind::new_game;
+        e.deposit = deposit;
+        trace::write(os, e);
+        act(s, blackjack::action::bet, bets, asset(), os);
+    }
+
+    void advance(slot& s, std::ostream& os) {
+        const auto ses_id = *s.ses_id;
+        if (d.session(ses_id).random_required) {
+            d.random(ses_id);
+            report(s, os);
+            return;
+        }
+        blackjack::blackjack::state_table states(d.get_self(), d.get_self().value);
+        const auto& state = states.get(ses_id);
+        const auto decision = decide(o.strategy, state);
+        const bool raise = decision == blackjack::strategy::double_down || decision == blackjack::strategy::split;
+        act(s, blackjack::action::play, {decision}, raise ? state.active().ante : asset(), os);
+    }
+
+    void act(slot& s, uint16_t type, const std::vector<param_t>& params, asset deposit, std::ostream& os) {
+        d.action(*s.ses_id, type, params, deposit);
+        e = {};
+        e.ses_id = *s.ses_id;
+        e.kind = trace::event_kind::action;
+        e.type = type;
+        e.params = params;
+        e.deposit = deposit.amount;
+        trace::write(os, e);
+        report(s, os);
+    }
+
+    // events of the last transaction
+    void report(slot& s, std::ostream& os) {
+        const auto ses_id = *s.ses_id;
+        const auto& ses = d.session(ses_id);
+        for (; s.messages < ses.messages.size(); s.messages++) {
+            e = {};
+            e.ses_id = ses_id;
+            e.kind = trace::event_kind::message;
+            e.msg = trace::serialize(ses.messages[s.messages]);
+            trace::write(os, e);
+        }
+        if (!ses.payout) {
+            return;
+        }
+        e = {};
+        e.ses_id = ses_id;
+        e.kind = trace::event_kind::finished;
+        e.payout = ses.payout->amount;
+        e.msg = trace::serialize(ses.finish_message);
+        trace::write(os, e);
+        game_sdk::host::get().sessions.erase(ses_id);
+        s.ses_id.reset();
+        open--;
+    }
+};
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    std::ios::sync_with_stdio(false);
+    try {
+        const auto o = parse_options(argc, argv);
+        feed(o).run(std::cout);
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
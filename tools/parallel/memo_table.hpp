@@ -0,0 +1,116 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <optional>
+
+// A memo of doubles by 64-bit keys shared by the tasks of a parallel recursion, without locks.
+// Slots are claimed by a CAS of the key and their value is published after it, so a reader may find a key
+// whose value isn't there yet: it's a miss and the value is computed twice, which only costs time since
+// the recursion's values are deterministic. The table doesn't grow, a key that finds no free slot within
+// a few probes isn't stored.
+namespace blackjack { namespace parallel {
+
+class memo_table {
+public:
+    // 2^log2_slots slots of 16 bytes
+    explicit memo_table(int log2_slots): mask((uint64_t(1) << log2_slots) - 1), slots(new slot[mask + 1]) {}
+
+    // key is never 0, it marks a free slot
+    std::optional<double> find(uint64_t key) const {
+        auto i = hash(key);
+        for (int probe = 0; probe < max_probes; probe++, i++) {
+            const auto& s = slots[i & mask];
+            const auto k = s.key.load(std::memory_order_acquire);
+            if (k == key) {
+                const auto v = s.value.load(std::memory_order_acquire);
+                return v == no_value ? std::nullopt : std::optional<double>(to_double(v));
+            }
+            if (!k) {
+                return std::nullopt;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void insert(uint64_t key, double value) {
+        auto i = hash(key);
+        for (int probe = 0; probe < max_probes; probe++, i++) {
+            auto& s = slots[i & mask];
+            auto k = s.key.load(std::memory_order_acquire);
+            if (!k && s.key.compare_exchange_strong(k, key, std::memory_order_acq_rel)) {
+                k = key;
+            }
+            if (k == key) {
+                s.value.store(to_bits(value), std::memory_order_release);
+                return;
+            }
+        }
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // not concurrently with the other methods
+    void clear() {
+        for (uint64_t i = 0; i <= mask; i++) {
+            slots[i].key.store(0, std::memory_order_relaxed);
+            slots[i].value.store(no_value, std::memory_order_relaxed);
+        }
+    }
+
+    // scans the table, for reports
+    uint64_t size() const {
+        uint64_t n = 0;
+        for (uint64_t i = 0; i <= mask; i++) {
+            n += slots[i].key.load(std::memory_order_relaxed) != 0;
+        }
+        return n;
+    }
+
+    uint64_t capacity() const {
+        return mask + 1;
+    }
+
+    // keys that found no free slot
+    uint64_t dropped_keys() const {
+        return dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    // the bits of a NaN no computation returns
+    static const uint64_t no_value = 0x7ff8dead0000beefull;
+    static const int max_probes = 32;
+
+    struct slot {
+        std::atomic<uint64_t> key{0};
+        std::atomic<uint64_t> value{no_value};
+    };
+
+    const uint64_t mask;
+    std::unique_ptr<slot[]> slots;
+    std::atomic<uint64_t> dropped{0};
+
+    // murmur3's finalizer, the keys are packed counts with most bits alike
+    static uint64_t hash(uint64_t k) {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdull;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ull;
+        return k ^ (k >> 33);
+    }
+
+    static uint64_t to_bits(double v) {
+        uint64_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        return bits;
+    }
+
+    static double to_double(uint64_t bits) {
+        double v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+};
+
+}} // ns blackjack::parallel
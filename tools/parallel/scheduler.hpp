@@ -0,0 +1,329 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fork-join tasks over a work-stealing pool, for recursions too irregular to split statically.
+// Every worker has a deque of tasks: it pushes the tasks it spawns and pops them back from the bottom, depth first,
+// while an idle worker steals from the top of another's deque, which holds the oldest, largest subtrees.
+// A task waiting for its children runs tasks itself meanwhile, so no worker blocks.
+//
+// Tasks live in the frame of the code that spawns them, which waits for them before returning:
+//
+//   sched.run([&] {
+//       fork_join(10, [&](int i) { results[i] = subtree(i); });
+//   });
+//
+// fork_join nests in the tasks, outside of run() it calls f serially.
+namespace blackjack { namespace parallel {
+
+class task_group;
+
+struct task {
+    void (*execute)(task*) = nullptr;
+    task_group* group = nullptr;
+};
+
+// Chase-Lev deque (Le et al., "Correct and efficient work-stealing for weak memory models") of a fixed capacity:
+// the owner pushes and pops at the bottom, thieves take from the top
+class task_deque {
+public:
+    static const int64_t capacity = 1 << 13;
+
+    // false if the deque is full, the owner runs the task itself then
+    bool push(task* t) {
+        const auto b = bottom.load(std::memory_order_relaxed);
+        if (b - top.load(std::memory_order_acquire) >= capacity) {
+            return false;
+        }
+        buffer[b & (capacity - 1)].store(t, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    task* pop() {
+        const auto b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        task* x = buffer[b & (capacity - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // the last task, a thief may be taking it
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                x = nullptr;
+            }
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return x;
+    }
+
+    task* steal() {
+        auto t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const auto b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        task* x = buffer[t & (capacity - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return x;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    alignas(64) std::array<std::atomic<task*>, capacity> buffer;
+};
+
+struct worker_stats {
+    uint64_t tasks = 0;
+    uint64_t steals = 0;
+    // tasks run by the spawning worker since its deque was full
+    uint64_t inline_tasks = 0;
+};
+
+class scheduler;
+
+namespace detail {
+    struct worker {
+        scheduler* owner = nullptr;
+        int index = 0;
+        uint64_t rng = 0;
+        task_deque deque;
+        worker_stats stats;
+    };
+
+    inline worker*& current_worker() {
+        static thread_local worker* w = nullptr;
+        return w;
+    }
+}
+
+class task_group {
+public:
+    task_group() = default;
+    task_group(const task_group&) = delete;
+
+    ~task_group() {
+        wait();
+    }
+
+    // within scheduler::run(), t stays alive until wait() returns
+    void spawn(task& t);
+
+    // runs the group's tasks and any others until all of the group's are done
+    void wait();
+
+    void done() {
+        pending.fetch_sub(1, std::memory_order_release);
+    }
+
+private:
+    std::atomic<int64_t> pending{0};
+};
+
+class scheduler {
+public:
+    // the thread calling run() is one of the workers
+    explicit scheduler(int threads = std::thread::hardware_concurrency()): workers(std::max(1, threads)) {
+        for (int i = 0; i < int(workers.size()); i++) {
+            workers[i] = std::make_unique<detail::worker>();
+            workers[i]->owner = this;
+            workers[i]->index = i;
+            workers[i]->rng = 0x9e3779b97f4a7c15 * (i + 1);
+        }
+        for (int i = 1; i < int(workers.size()); i++) {
+            pool.emplace_back([this, i] { thief_loop(*workers[i]); });
+        }
+    }
+
+    ~scheduler() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& t : pool) {
+            t.join();
+        }
+    }
+
+    int size() const {
+        return workers.size();
+    }
+
+    // runs root as worker 0 and returns once it and every task it's spawned are done
+    template <typename F>
+    void run(F&& root) {
+        auto& w = *workers[0];
+        detail::current_worker() = &w;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = true;
+        }
+        wake.notify_all();
+        root();
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            running = false;
+        }
+        detail::current_worker() = nullptr;
+    }
+
+    std::vector<worker_stats> stats() const {
+        std::vector<worker_stats> result;
+        for (const auto& w : workers) {
+            result.push_back(w->stats);
+        }
+        return result;
+    }
+
+    // a task of another worker, nullptr if there was none to take
+    task* steal(detail::worker& thief) {
+        const int n = workers.size();
+        if (n == 1) {
+            return nullptr;
+        }
+        // xorshift, victims are picked at random so thieves don't crowd the same deque
+        thief.rng ^= thief.rng << 13;
+        thief.rng ^= thief.rng >> 7;
+        thief.rng ^= thief.rng << 17;
+        const int start = thief.rng % n;
+        for (int i = 0; i < n; i++) {
+            const int victim = (start + i) % n;
+            if (victim == thief.index) {
+                continue;
+            }
+            if (auto t = workers[victim]->deque.steal()) {
+                thief.stats.steals++;
+                return t;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    std::vector<std::unique_ptr<detail::worker>> workers;
+    std::vector<std::thread> pool;
+    std::mutex mutex;
+    std::condition_variable wake;
+    bool running = false;
+    bool stopping = false;
+
+    void thief_loop(detail::worker& w) {
+        detail::current_worker() = &w;
+        int idle = 0;
+        while (true) {
+            if (auto t = steal(w)) {
+                w.stats.tasks++;
+                t->execute(t);
+                idle = 0;
+                continue;
+            }
+            if (++idle < 64) {
+                std::this_thread::yield();
+                continue;
+            }
+            // nothing to steal for a while: sleep until the next run, checking now and then within one
+            std::unique_lock<std::mutex> lock(mutex);
+            if (stopping) {
+                return;
+            }
+            if (running) {
+                lock.unlock();
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            } else {
+                wake.wait(lock, [&] { return running || stopping; });
+            }
+            idle = 0;
+        }
+    }
+};
+
+inline void task_group::spawn(task& t) {
+    t.group = this;
+    pending.fetch_add(1, std::memory_order_relaxed);
+    auto w = detail::current_worker();
+    if (!w->deque.push(&t)) {
+        w->stats.inline_tasks++;
+        t.execute(&t);
+    }
+}
+
+inline void task_group::wait() {
+    auto w = detail::current_worker();
+    while (pending.load(std::memory_order_acquire) > 0) {
+        // the group's tasks are on top of the own deque unless they've been stolen
+        task* t = w->deque.pop();
+        if (!t) {
+            t = w->owner->steal(*w);
+        }
+        if (t) {
+            w->stats.tasks++;
+            t->execute(t);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+namespace detail {
+    template <typename F>
+    struct indexed_task: task {
+        F* f;
+        int i;
+
+        static void execute_it(task* t) {
+            auto self = static_cast<indexed_task*>(t);
+            (*self->f)(self->i);
+            self->group->done();
+        }
+    };
+}
+
+// f(0) .. f(n - 1) as tasks, f(0) on the calling worker; returns once all are done
+template <typename F>
+void fork_join(int n, F&& f) {
+    if (!detail::current_worker() || n == 1) {
+        for (int i = 0; i < n; i++) {
+            f(i);
+        }
+        return;
+    }
+    using task_t = detail::indexed_task<std::remove_reference_t<F>>;
+    // the children of most forks are the card weights
+    std::array<task_t, 16> local;
+    std::unique_ptr<task_t[]> allocated;
+    task_t* tasks = local.data();
+    if (n > int(local.size())) {
+        allocated.reset(new task_t[n]);
+        tasks = allocated.get();
+    }
+    task_group group;
+    // pushed last first, so the worker pops them in order
+    for (int i = n - 1; i > 0; i--) {
+        tasks[i].execute = &task_t::execute_it;
+        tasks[i].f = &f;
+        tasks[i].i = i;
+        group.spawn(tasks[i]);
+    }
+    f(0);
+    group.wait();
+}
+
+}} // ns blackjack::parallel
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Binary files of the RTP tools: a magic followed by the fields a type's serialize(ar) visits.
+namespace blackjack { namespace rtp {
+
+namespace detail {
+
+// values are stored in the host's byte order
+template <typename Stream>
+class archive {
+public:
+    explicit archive(Stream& s): s(s) {}
+
+    template <typename... T>
+    void operator()(T&... values) {
+        (io(values), ...);
+    }
+
+private:
+    Stream& s;
+
+    static constexpr bool reading = std::is_base_of_v<std::istream, Stream>;
+
+    template <typename T>
+    void raw(T& v) {
+        if constexpr (reading) {
+            s.read(reinterpret_cast<char*>(&v), sizeof(v));
+        } else {
+            s.write(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+    }
+
+    template <typename T>
+    void io(T& v) {
+        if constexpr (std::is_arithmetic_v<T> || std::is_same_v<T, __int128>) {
+            raw(v);
+        } else {
+            v.serialize(*this);
+        }
+    }
+
+    template <typename T, size_t N>
+    void io(std::array<T, N>& a) {
+        for (auto& v : a) {
+            io(v);
+        }
+    }
+
+    template <typename Container>
+    void io_sized(Container& c) {
+        uint64_t size = c.size();
+        raw(size);
+        c.resize(size);
+        for (auto& v : c) {
+            io(v);
+        }
+    }
+
+    template <typename T>
+    void io(std::vector<T>& v) {
+        io_sized(v);
+    }
+
+    void io(std::string& v) {
+        io_sized(v);
+    }
+
+    template <typename K, typename V>
+    void io(std::map<K, V>& m) {
+        uint64_t size = m.size();
+        raw(size);
+        if constexpr (reading) {
+            m.clear();
+            for (uint64_t i = 0; i < size && s; i++) {
+                K k{};
+                V v{};
+                io(k);
+                io(v);
+                m.emplace(std::move(k), std::move(v));
+            }
+        } else {
+            for (auto& [k, v] : m) {
+                auto key = k;
+                io(key);
+                io(v);
+            }
+        }
+    }
+};
+
+} // ns detail
+
+template <typename T>
+T load_file(const std::string& path, const char (&magic)[8]) {
+    std::ifstream in(path, std::ios::binary);
+    char header[8] = {};
+    in.read(header, sizeof(header));
+    if (!in || !std::equal(header, header + sizeof(header), magic)) {
+        throw std::runtime_error(path + " isn't a file of the expected kind");
+    }
+    T value;
+    detail::archive<std::istream> ar(in);
+    ar(value);
+    if (!in) {
+        throw std::runtime_error(path + " is truncated");
+    }
+    return value;
+}
+
+// the file is replaced atomically, a crash leaves either the previous or the new content
+template <typename T>
+void save_file(const std::string& path, const char (&magic)[8], T& value) {
+    const std::string tmp = path + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        out.write(magic, sizeof(magic));
+        detail::archive<std::ostream> ar(out);
+        ar(value);
+        out.flush();
+        if (!out) {
+            throw std::runtime_error("can't write " + tmp);
+        }
+    }
+    if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+        throw std::runtime_error("can't replace " + path);
+    }
+}
+
+}} // ns blackjack::rtp
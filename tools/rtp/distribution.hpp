@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+
+// Distribution of a round's net win. Outcomes are amounts in the smallest units of the asset,
+// weights are probabilities for exact distributions and game counts for simulated ones.
+namespace blackjack { namespace rtp {
+
+class distribution {
+    std::map<int64_t, double> weights;
+
+public:
+    void add(int64_t outcome, double weight = 1) {
+        weights[outcome] += weight;
+    }
+
+    void merge(const distribution& o) {
+        for (const auto& [outcome, weight] : o.weights) {
+            weights[outcome] += weight;
+        }
+    }
+
+    const std::map<int64_t, double>& outcomes() const {
+        return weights;
+    }
+
+    double total() const {
+        double t = 0;
+        for (const auto& [outcome, weight] : weights) {
+            t += weight;
+        }
+        return t;
+    }
+
+    double probability(int64_t outcome) const {
+        const auto it = weights.find(outcome);
+        return it != weights.end() ? it->second / total() : 0;
+    }
+
+    // central moment of the given order, the mean for order 1
+    double moment(int order) const {
+        const double t = total();
+        double mean = 0;
+        for (const auto& [outcome, weight] : weights) {
+            mean += outcome * weight / t;
+        }
+        if (order == 1) {
+            return mean;
+        }
+        double m = 0;
+        for (const auto& [outcome, weight] : weights) {
+            m += std::pow(outcome - mean, order) * weight / t;
+        }
+        return m;
+    }
+
+    double mean() const {
+        return moment(1);
+    }
+
+    double variance() const {
+        return moment(2);
+    }
+
+    double skewness() const {
+        return moment(3) / std::pow(variance(), 1.5);
+    }
+
+    // the smallest outcome with P(win <= outcome) >= q
+    int64_t quantile(double q) const {
+        const double t = total();
+        double cdf = 0;
+        for (const auto& [outcome, weight] : weights) {
+            cdf += weight / t;
+            if (cdf >= q) {
+                return outcome;
+            }
+        }
+        return weights.rbegin()->first;
+    }
+
+    // P(win > outcome)
+    double tail(int64_t outcome) const {
+        double w = 0;
+        for (auto it = weights.upper_bound(outcome); it != weights.end(); ++it) {
+            w += it->second;
+        }
+        return w / total();
+    }
+
+    // wins over max_win are paid max_win, as the contract does with param::max_payout
+    distribution capped(int64_t max_win) const {
+        distribution d;
+        for (const auto& [outcome, weight] : weights) {
+            d.add(std::min(outcome, max_win), weight);
+        }
+        return d;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(weights);
+    }
+};
+
+}} // ns blackjack::rtp
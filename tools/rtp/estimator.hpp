@@ -0,0 +1,304 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+// RTP estimators. RTP is a ratio, returned over staked, since doubles and splits change the stake;
+// variances are delta method ones. Every estimator keeps running integer sums only, so estimators
+// of separate runs merge exactly, in any order.
+namespace blackjack { namespace rtp {
+
+// two-sided 95% normal quantile
+const double z95 = 1.959963984540054;
+
+// amounts in the smallest units of the asset
+struct sample {
+    int64_t returned = 0;
+    int64_t staked = 0;
+};
+
+// products of amounts overflow 64 bits after a few billion games
+using wide_t = __int128;
+
+// sums of y, x and their products, enough for a ratio and its variance
+struct ratio_sums {
+    int64_t n = 0;
+    int64_t y = 0, x = 0;
+    wide_t yy = 0, xy = 0, xx = 0;
+
+    void add(const sample& s) {
+        n++;
+        y += s.returned;
+        x += s.staked;
+        yy += wide_t(s.returned) * s.returned;
+        xy += wide_t(s.returned) * s.staked;
+        xx += wide_t(s.staked) * s.staked;
+    }
+
+    void merge(const ratio_sums& o) {
+        n += o.n;
+        y += o.y;
+        x += o.x;
+        yy += o.yy;
+        xy += o.xy;
+        xx += o.xx;
+    }
+
+    // sample variance of the residuals y - r * x
+    double residual_variance(double r) const {
+        if (n < 2) {
+            return 0;
+        }
+        const long double mean = (y - r * (long double)x) / n;
+        const long double ss = (long double)yy - 2 * r * (long double)xy + r * r * (long double)xx - n * mean * mean;
+        return std::max(double(ss), 0.) / (n - 1);
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(n, y, x, yy, xy, xx);
+    }
+};
+
+// plain sampling, a sample is a game
+class ratio_estimator {
+    ratio_sums sums;
+
+public:
+    void add(const sample& s) {
+        sums.add(s);
+    }
+
+    void merge(const ratio_estimator& o) {
+        sums.merge(o.sums);
+    }
+
+    int64_t size() const {
+        return sums.n;
+    }
+
+    double value() const {
+        return sums.x ? double(sums.y) / sums.x : 0;
+    }
+
+    double variance() const {
+        if (sums.n < 2) {
+            return INFINITY;
+        }
+        const double mean_x = double(sums.x) / sums.n;
+        return sums.residual_variance(value()) / (sums.n * mean_x * mean_x);
+    }
+
+    double half_width(double z = z95) const {
+        return z * std::sqrt(variance());
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(sums);
+    }
+};
+
+// stratified sampling with known stratum probabilities, the combined ratio estimator
+class stratified_estimator {
+    std::vector<double> weights;
+    std::vector<ratio_sums> strata;
+
+public:
+    stratified_estimator() = default;
+
+    explicit stratified_estimator(std::vector<double> weights):
+        weights(std::move(weights)), strata(this->weights.size()) {}
+
+    void add(size_t stratum, const sample& s) {
+        strata[stratum].add(s);
+    }
+
+    // both must have the same strata
+    bool merge(const stratified_estimator& o) {
+        if (o.weights != weights) {
+            return false;
+        }
+        for (size_t h = 0; h < strata.size(); h++) {
+            strata[h].merge(o.strata[h]);
+        }
+        return true;
+    }
+
+    int64_t size() const {
+        int64_t n = 0;
+        for (const auto& s : strata) {
+            n += s.n;
+        }
+        return n;
+    }
+
+    double value() const {
+        double y = 0, x = 0;
+        for (size_t h = 0; h < strata.size(); h++) {
+            if (strata[h].n) {
+                y += weights[h] * double(strata[h].y) / strata[h].n;
+                x += weights[h] * double(strata[h].x) / strata[h].n;
+            }
+        }
+        return x ? y / x : 0;
+    }
+
+    double variance() const {
+        const double r = value();
+        double var = 0, x = 0;
+        for (size_t h = 0; h < strata.size(); h++) {
+            const auto& s = strata[h];
+            if (weights[h] > 0 && s.n < 2) {
+                return INFINITY;
+            }
+            if (s.n) {
+                var += weights[h] * weights[h] * s.residual_variance(r) / s.n;
+                x += weights[h] * double(s.x) / s.n;
+            }
+        }
+        return var / (x * x);
+    }
+
+    double half_width(double z = z95) const {
+        return z * std::sqrt(variance());
+    }
+
+    // Neyman allocation of the next n samples: proportional to weight * residual std dev,
+    // every stratum gets at least `min` samples in total; randomized rounding by `u`
+    template <typename Uniform>
+    std::vector<int64_t> allocate(int64_t n, Uniform&& u, int64_t min = 2) const {
+        const double r = value();
+        std::vector<double> shares(strata.size());
+        for (size_t h = 0; h < strata.size(); h++) {
+            shares[h] = weights[h] * (strata[h].n >= 2 ? std::sqrt(strata[h].residual_variance(r)) : 1);
+        }
+        const double total = std::accumulate(shares.begin(), shares.end(), 0.);
+        std::vector<int64_t> counts(strata.size());
+        for (size_t h = 0; h < strata.size(); h++) {
+            const double share = total > 0 ? n * shares[h] / total : 0;
+            counts[h] = int64_t(share) + (u() < share - int64_t(share));
+            if (weights[h] > 0) {
+                counts[h] = std::max(counts[h], min - strata[h].n);
+            }
+        }
+        return counts;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(weights, strata);
+    }
+};
+
+// two variants played on common random numbers: the difference of their RTPs
+// has a much smaller variance than if they were sampled independently
+class paired_estimator {
+    // sums of (y_a, x_a, y_b, x_b) and of their pairwise products
+    int64_t n = 0;
+    std::array<int64_t, 4> s{};
+    std::array<std::array<wide_t, 4>, 4> ss{};
+
+    double ratio(int i) const {
+        return s[i + 1] ? double(s[i]) / s[i + 1] : 0;
+    }
+
+    // variance of the mean of c . v
+    double variance(const std::array<double, 4>& c) const {
+        if (n < 2) {
+            return INFINITY;
+        }
+        long double mean = 0, sq = 0;
+        for (int i = 0; i < 4; i++) {
+            mean += c[i] * (long double)s[i] / n;
+            for (int j = 0; j < 4; j++) {
+                sq += c[i] * c[j] * (long double)ss[i][j];
+            }
+        }
+        return std::max(double(sq - n * mean * mean), 0.) / (n - 1) / n;
+    }
+
+    // linearized RTP of a variant
+    std::array<double, 4> gradient(int i, double sign) const {
+        std::array<double, 4> c{};
+        const double mean_x = double(s[i + 1]) / n;
+        c[i] = sign / mean_x;
+        c[i + 1] = -sign * ratio(i) / mean_x;
+        return c;
+    }
+
+public:
+    void add(const sample& a, const sample& b) {
+        const std::array<int64_t, 4> v{a.returned, a.staked, b.returned, b.staked};
+        n++;
+        for (int i = 0; i < 4; i++) {
+            s[i] += v[i];
+            for (int j = 0; j < 4; j++) {
+                ss[i][j] += wide_t(v[i]) * v[j];
+            }
+        }
+    }
+
+    void merge(const paired_estimator& o) {
+        n += o.n;
+        for (int i = 0; i < 4; i++) {
+            s[i] += o.s[i];
+            for (int j = 0; j < 4; j++) {
+                ss[i][j] += o.ss[i][j];
+            }
+        }
+    }
+
+    int64_t size() const {
+        return n;
+    }
+
+    double value_a() const {
+        return ratio(0);
+    }
+
+    double value_b() const {
+        return ratio(2);
+    }
+
+    double difference() const {
+        return value_a() - value_b();
+    }
+
+    double variance() const {
+        auto c = gradient(0, 1);
+        const auto b = gradient(2, -1);
+        for (int i = 0; i < 4; i++) {
+            c[i] += b[i];
+        }
+        return variance(c);
+    }
+
+    double variance_a() const {
+        return variance(gradient(0, 1));
+    }
+
+    double variance_b() const {
+        return variance(gradient(2, 1));
+    }
+
+    // what the variance of the difference would be with independent samples
+    double independent_variance() const {
+        return variance_a() + variance_b();
+    }
+
+    double half_width(double z = z95) const {
+        return z * std::sqrt(variance());
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(n, s, ss);
+    }
+};
+
+}} // ns blackjack::rtp
@@ -0,0 +1,42 @@
+// Merges the result files of RTP run shards, see rtp_estimate, and reports the estimate.
+// Merging is exact, merged results can be merged again; a shard can't be merged twice.
+//
+// Usage: rtp_merge [ --out <merged file> ] <result file>...
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "shard.hpp"
+
+int main(int argc, char** argv) {
+    std::string out;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) {
+            out = argv[++i];
+        } else {
+            files.push_back(arg);
+        }
+    }
+    if (files.empty()) {
+        std::cerr << "Usage: rtp_merge [ --out <merged file> ] <result file>..." << std::endl;
+        return EXIT_FAILURE;
+    }
+    try {
+        auto merged = blackjack::rtp::load(files.front());
+        for (size_t i = 1; i < files.size(); i++) {
+            merged.merge(blackjack::rtp::load(files[i]));
+        }
+        if (!out.empty()) {
+            blackjack::rtp::save(out, merged);
+        }
+        blackjack::rtp::print(std::cout, merged);
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
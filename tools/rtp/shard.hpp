@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "archive.hpp"
+#include "estimator.hpp"
+
+// Result files of sharded RTP runs. A shard is a seeded sequence of batches; its file is rewritten
+// after every batch, so a killed shard resumes from the last batch written. Results of the shards
+// of a run merge exactly, whichever machines ran them and in whatever order they are merged.
+namespace blackjack { namespace rtp {
+
+// what a run estimates, all of its shards have the same config
+struct run_config {
+    std::string mode;
+    std::string strategy;
+    // the strategy played on common random numbers, empty if none
+    std::string compare;
+    uint64_t seed = 0;
+    int64_t batch = 0;
+
+    bool operator==(const run_config& c) const {
+        return mode == c.mode && strategy == c.strategy && compare == c.compare && seed == c.seed && batch == c.batch;
+    }
+
+    bool operator!=(const run_config& c) const {
+        return !(*this == c);
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(mode, strategy, compare, seed, batch);
+    }
+};
+
+struct shard_result {
+    run_config config;
+    // shards merged into the result
+    std::vector<uint32_t> shards;
+    int64_t batches = 0;
+    int64_t games = 0;
+    // only the one of the config's mode is used
+    ratio_estimator plain;
+    stratified_estimator stratified;
+    paired_estimator paired;
+
+    bool is_stratified() const {
+        return config.mode == "stratified";
+    }
+
+    bool is_paired() const {
+        return !config.compare.empty();
+    }
+
+    // of the RTP, or of the RTP difference for paired runs
+    double half_width() const {
+        return is_stratified() ? stratified.half_width() : is_paired() ? paired.half_width() : plain.half_width();
+    }
+
+    void merge(const shard_result& o) {
+        if (o.config != config) {
+            throw std::runtime_error("results of different runs can't be merged");
+        }
+        for (const auto s : o.shards) {
+            if (std::find(shards.begin(), shards.end(), s) != shards.end()) {
+                throw std::runtime_error("shard #" + std::to_string(s) + " is merged twice");
+            }
+            shards.push_back(s);
+        }
+        std::sort(shards.begin(), shards.end());
+        batches += o.batches;
+        games += o.games;
+        plain.merge(o.plain);
+        if (is_stratified() && !stratified.merge(o.stratified)) {
+            throw std::runtime_error("results have different strata");
+        }
+        paired.merge(o.paired);
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar) {
+        ar(config, shards, batches, games);
+        if (is_stratified()) {
+            ar(stratified);
+        } else if (is_paired()) {
+            ar(paired);
+        } else {
+            ar(plain);
+        }
+    }
+};
+
+namespace detail {
+
+const char magic[8] = {'B', 'J', 'R', 'T', 'P', 0, 0, 1};
+
+} // ns detail
+
+inline shard_result load(const std::string& path) {
+    return load_file<shard_result>(path, detail::magic);
+}
+
+inline void save(const std::string& path, shard_result& result) {
+    save_file(path, detail::magic, result);
+}
+
+inline void print_interval(std::ostream& os, const std::string& what, double value, double half_width) {
+    os << what << " " << std::fixed << std::setprecision(5) << value << " +- " << half_width
+       << " [" << value - half_width << ", " << value + half_width << "]" << std::endl;
+}
+
+inline void print(std::ostream& os, const shard_result& r) {
+    os << r.games << (r.is_paired() ? " games per strategy" : " games") << " in " << r.batches << " batches of "
+       << r.shards.size() << " shard(s)" << std::endl;
+    if (r.is_paired()) {
+        print_interval(os, "RTP", r.paired.value_a(), z95 * std::sqrt(r.paired.variance_a()));
+        print_interval(os, "compared RTP", r.paired.value_b(), z95 * std::sqrt(r.paired.variance_b()));
+        print_interval(os, "difference", r.paired.difference(), r.paired.half_width());
+        os << "common random numbers variance reduction x" << std::setprecision(1)
+           << r.paired.independent_variance() / r.paired.variance() << std::endl;
+        return;
+    }
+    const double variance = r.is_stratified() ? r.stratified.variance() : r.plain.variance();
+    print_interval(os, "RTP", r.is_stratified() ? r.stratified.value() : r.plain.value(), z95 * std::sqrt(variance));
+    // the variance of a single game's worth of sampling, comparable across modes
+    os << "variance x games " << std::setprecision(4) << variance * r.games << std::endl;
+}
+
+}} // ns blackjack::rtp
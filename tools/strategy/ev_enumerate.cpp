@@ -0,0 +1,415 @@
+// Enumerates the EV of every initial deal of the main game under composition-dependent optimal play, in parallel.
+// A decision's EV is taken over the shoe without the up card and all the player's cards seen so far. Split hands
+// are played one after the other as the contract's finish_first_round does: both get their second card on the split,
+// the first hand is played knowing the second's two cards, the second one knowing every card the first has ended
+// with, so its EV is averaged over the first hand's outcomes. The recursion is very irregular, split hands of some
+// up cards take most of the time, so hands and dealer draw-outs are forked as tasks of a work-stealing scheduler
+// that share one memo of EVs.
+// Results don't depend on the number of threads: every sum is taken in the same order and a memoised EV is the one
+// a recomputation gives. --check runs the enumeration again with the given threads and compares them bit for bit.
+//
+// Usage: ev_enumerate [ --threads <n> ] [ --up <cards, e.g. A6T> ] [ --memo <log2 slots> ] [ --check <threads> ]
+// All the up cards by default, the EV reported is the one over the up cards enumerated.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <parallel/memo_table.hpp>
+#include <parallel/scheduler.hpp>
+
+#include "rules.hpp"
+
+namespace {
+
+using namespace blackjack::rules;
+namespace parallel = blackjack::parallel;
+
+// bits of the count of every weight in a hand of up to hard 30, i.e. a bust, 29 in all
+const int count_bits[weights + 1] = {0, 5, 4, 3, 3, 3, 3, 2, 2, 2, 2};
+
+uint64_t pack(const hand& h) {
+    uint64_t k = 0;
+    for (int w = 1; w <= weights; w++) {
+        k = k << count_bits[w] | h.counts[w];
+    }
+    return k;
+}
+
+// a hand is played against the up card with other player's cards out of the shoe as well
+struct context {
+    int up;
+    hand removed;
+};
+
+struct deal {
+    int up;
+    int first;
+    int second;
+    double p;
+    double ev;
+};
+
+class enumerator {
+public:
+    explicit enumerator(parallel::memo_table& memo): memo(memo) {}
+
+    double stand_ev(const context& c, const hand& h) {
+        if (h.hard > 21) {
+            return -1;
+        }
+        const auto k = key(0, c, h);
+        if (const auto cached = memo.find(k)) {
+            return *cached;
+        }
+        const auto s = shoe_for(c, h);
+        // draw-outs by the dealer's second card
+        std::array<dealer_probs_t, weights> by_card{};
+        parallel::fork_join(weights, [&](int i) {
+            const int w = i + 1;
+            if (!s.counts[w]) {
+                return;
+            }
+            auto rest = s;
+            rest.counts[w]--;
+            rest.size--;
+            dealer_draw(rest, c.up + w, c.up == 1 || w == 1, 2, s.p(w), by_card[i]);
+        });
+        dealer_probs_t probs{};
+        for (const auto& p : by_card) {
+            for (size_t j = 0; j < probs.size(); j++) {
+                probs[j] += p[j];
+            }
+        }
+        // the player's hand is never a blackjack here, so any dealer's blackjack beats it
+        const int t = h.total();
+        double ev = probs[dealer_bust] - probs[dealer_bj];
+        for (int d = 17; d <= 21; d++) {
+            ev += t > d ? probs[d - 17] : t < d ? -probs[d - 17] : 0;
+        }
+        memo.insert(k, ev);
+        return ev;
+    }
+
+    double hit_ev(const context& c, const hand& h) {
+        const auto s = shoe_for(c, h);
+        std::array<double, weights> evs{};
+        parallel::fork_join(weights, [&](int i) {
+            if (s.counts[i + 1]) {
+                evs[i] = s.p(i + 1) * play_ev(c, h.add(i + 1));
+            }
+        });
+        return sum(evs);
+    }
+
+    double double_ev(const context& c, const hand& h) {
+        const auto s = shoe_for(c, h);
+        std::array<double, weights> evs{};
+        parallel::fork_join(weights, [&](int i) {
+            if (s.counts[i + 1]) {
+                evs[i] = s.p(i + 1) * stand_ev(c, h.add(i + 1));
+            }
+        });
+        return 2 * sum(evs);
+    }
+
+    // the best of standing and hitting, 21 stands automatically
+    double play_ev(const context& c, const hand& h) {
+        if (h.hard > 21) {
+            return -1;
+        }
+        if (h.total() == 21) {
+            return stand_ev(c, h);
+        }
+        const auto k = key(1, c, h);
+        if (const auto cached = memo.find(k)) {
+            return *cached;
+        }
+        double stand = 0, hit = 0;
+        parallel::fork_join(2, [&](int i) {
+            (i ? hit : stand) = i ? hit_ev(c, h) : stand_ev(c, h);
+        });
+        const double ev = std::max(stand, hit);
+        memo.insert(k, ev);
+        return ev;
+    }
+
+    // a hand of two cards, doubling is allowed
+    double first_ev(const context& c, const hand& h) {
+        const double play = play_ev(c, h);
+        return can_double(h) ? std::max(play, double_ev(c, h)) : play;
+    }
+
+    // the final hands a hand is played to by the decisions of first_ev, with their probabilities
+    void outcomes(const context& c, const hand& h, double p, bool first, std::vector<std::pair<hand, double>>& out) {
+        if (h.hard > 21 || h.total() == 21) {
+            out.emplace_back(h, p);
+            return;
+        }
+        const double stand = stand_ev(c, h), hit = hit_ev(c, h);
+        const auto s = shoe_for(c, h);
+        if (first && can_double(h) && double_ev(c, h) > std::max(stand, hit)) {
+            for (int w = 1; w <= weights; w++) {
+                if (s.counts[w]) {
+                    out.emplace_back(h.add(w), p * s.p(w));
+                }
+            }
+            return;
+        }
+        if (hit <= stand) {
+            out.emplace_back(h, p);
+            return;
+        }
+        for (int w = 1; w <= weights; w++) {
+            if (s.counts[w]) {
+                outcomes(c, h.add(w), p * s.p(w), false, out);
+            }
+        }
+    }
+
+    // both hands of a pair of w split against the up card
+    double split_ev(int up, int w) {
+        hand pair;
+        pair = pair.add(w).add(w);
+        const auto s = shoe_for({up, hand{}}, pair);
+        // the second cards of the hands, as dealt on the split
+        std::array<double, weights * weights> evs{};
+        parallel::fork_join(weights * weights, [&](int i) {
+            const int c1 = i / weights + 1, c2 = i % weights + 1;
+            if (!s.counts[c1] || s.counts[c2] < 1 + (c1 == c2)) {
+                return;
+            }
+            const double p = s.p(c1) * (s.counts[c2] - (c1 == c2)) / (s.size - 1);
+            hand first, second;
+            first = first.add(w).add(c1);
+            second = second.add(w).add(c2);
+            // one card on each split ace
+            if (w == 1) {
+                evs[i] = p * (stand_ev({up, second}, first) + stand_ev({up, first}, second));
+                return;
+            }
+            const double first_hand = first_ev({up, second}, first);
+            std::vector<std::pair<hand, double>> finals;
+            outcomes({up, second}, first, 1, true, finals);
+            merge_same(finals);
+            std::vector<double> second_hand(finals.size());
+            parallel::fork_join(finals.size(), [&](int j) {
+                second_hand[j] = finals[j].second * first_ev({up, finals[j].first}, second);
+            });
+            double second_sum = 0;
+            for (const auto v : second_hand) {
+                second_sum += v;
+            }
+            evs[i] = p * (first_hand + second_sum);
+        });
+        double ev = 0;
+        for (const auto v : evs) {
+            ev += v;
+        }
+        return ev;
+    }
+
+    double deal_ev(int up, int a, int b) {
+        hand h;
+        h = h.add(a).add(b);
+        const auto s = shoe_for({up, hand{}}, h);
+        if (h.total() == 21) {
+            // a blackjack pays 3:2 unless the dealer has one too
+            const double dealer_bj = up == 1 ? s.p(10) : up == 10 ? s.p(1) : 0;
+            return 1.5 * (1 - dealer_bj);
+        }
+        const double ev = first_ev({up, hand{}}, h);
+        return a == b ? std::max(ev, split_ev(up, a)) : ev;
+    }
+
+private:
+    parallel::memo_table& memo;
+
+    // the marker bit keeps keys off 0, then the table, the up card, the other cards out and the hand
+    static uint64_t key(uint64_t table, const context& c, const hand& h) {
+        return uint64_t(1) << 63 | table << 62 | uint64_t(c.up) << 58 | pack(c.removed) << 29 | pack(h);
+    }
+
+    static shoe shoe_for(const context& c, const hand& h) {
+        auto s = shoe::full();
+        s.remove(h);
+        s.remove(c.removed);
+        s.counts[c.up]--;
+        s.size--;
+        return s;
+    }
+
+    // hits in another order end with the same cards, the second hand is played against them once
+    static void merge_same(std::vector<std::pair<hand, double>>& finals) {
+        std::sort(finals.begin(), finals.end(), [](const auto& a, const auto& b) {
+            return pack(a.first) < pack(b.first);
+        });
+        size_t n = 0;
+        for (size_t i = 0; i < finals.size(); i++) {
+            if (n && pack(finals[n - 1].first) == pack(finals[i].first)) {
+                finals[n - 1].second += finals[i].second;
+            } else {
+                finals[n++] = finals[i];
+            }
+        }
+        finals.resize(n);
+    }
+
+    static double sum(const std::array<double, weights>& evs) {
+        double total = 0;
+        for (const auto v : evs) {
+            total += v;
+        }
+        return total;
+    }
+};
+
+// the player's two cards (first <= second) against the up card, with their probability from a full shoe
+std::vector<deal> initial_deals(int up) {
+    std::vector<deal> deals;
+    const auto full = shoe::full();
+    for (int a = 1; a <= weights; a++) {
+        for (int b = a; b <= weights; b++) {
+            auto s = full;
+            double p = 1;
+            for (const int w : {a, b, up}) {
+                p *= s.p(w);
+                s.counts[w]--;
+                s.size--;
+            }
+            deals.push_back({up, a, b, a == b ? p : 2 * p, 0});
+        }
+    }
+    return deals;
+}
+
+struct run_result {
+    std::vector<deal> deals;
+    double seconds = 0;
+    std::vector<parallel::worker_stats> workers;
+    // the most EVs memoised for an up card
+    uint64_t memo_size = 0;
+    uint64_t memo_capacity = 0;
+    uint64_t memo_dropped = 0;
+};
+
+// an up card after another, the EVs of one up card share nothing with the others', so the memo's cleared
+// between them and an up card's deals and splits are enough tasks for the workers
+run_result enumerate(const std::vector<int>& ups, int threads, int memo_log2) {
+    run_result r;
+    parallel::memo_table memo(memo_log2);
+    parallel::scheduler sched(threads);
+    enumerator e(memo);
+    const auto start = std::chrono::steady_clock::now();
+    for (const int up : ups) {
+        auto deals = initial_deals(up);
+        sched.run([&] {
+            parallel::fork_join(deals.size(), [&](int i) {
+                auto& d = deals[i];
+                d.ev = e.deal_ev(d.up, d.first, d.second);
+            });
+        });
+        r.deals.insert(r.deals.end(), deals.begin(), deals.end());
+        r.memo_size = std::max(r.memo_size, memo.size());
+        memo.clear();
+    }
+    r.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    r.workers = sched.stats();
+    r.memo_capacity = memo.capacity();
+    r.memo_dropped = memo.dropped_keys();
+    return r;
+}
+
+const char* card_names = "A23456789T";
+
+void report(const run_result& r, int threads) {
+    double ev = 0, p = 0;
+    std::array<double, weights> up_ev{}, up_p{};
+    for (const auto& d : r.deals) {
+        ev += d.p * d.ev;
+        p += d.p;
+        up_ev[d.up - 1] += d.p * d.ev;
+        up_p[d.up - 1] += d.p;
+    }
+    // of the up cards enumerated
+    std::cout << std::fixed << std::setprecision(6) << "EV " << ev / p << " of the ante, by up card:";
+    for (int i = 0; i < weights; i++) {
+        if (up_p[i]) {
+            std::cout << ' ' << card_names[i] << ' ' << up_ev[i] / up_p[i];
+        }
+    }
+    uint64_t tasks = 0, steals = 0, inline_tasks = 0;
+    for (const auto& w : r.workers) {
+        tasks += w.tasks;
+        steals += w.steals;
+        inline_tasks += w.inline_tasks;
+    }
+    std::cout << std::setprecision(3) << "\n" << threads << " threads: " << r.seconds << "s, " << tasks << " tasks, "
+              << steals << " steals, " << inline_tasks << " run inline, memo " << r.memo_size << " of "
+              << r.memo_capacity << " slots, " << r.memo_dropped << " dropped" << std::endl;
+}
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    int threads = std::thread::hardware_concurrency();
+    int memo_log2 = 25;
+    int check = 0;
+    std::vector<int> ups;
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        if (i + 1 == argc) {
+            std::cerr << "missing value of " << arg << std::endl;
+            return EXIT_FAILURE;
+        }
+        const std::string value = argv[++i];
+        if (arg == "--threads") {
+            threads = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--memo") {
+            memo_log2 = std::min(std::max(10, std::atoi(value.c_str())), 32);
+        } else if (arg == "--check") {
+            check = std::max(1, std::atoi(value.c_str()));
+        } else if (arg == "--up") {
+            for (const char c : value) {
+                const auto name = std::strchr(card_names, c);
+                if (!c || !name) {
+                    std::cerr << "unknown up card " << c << std::endl;
+                    return EXIT_FAILURE;
+                }
+                ups.push_back(name - card_names + 1);
+            }
+        } else {
+            std::cerr << "Usage: ev_enumerate [ --threads <n> ] [ --up <cards, e.g. A6T> ] [ --memo <log2 slots> ]"
+                         " [ --check <threads> ]" << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+    if (ups.empty()) {
+        for (int up = 1; up <= weights; up++) {
+            ups.push_back(up);
+        }
+    }
+    const auto result = enumerate(ups, threads, memo_log2);
+    report(result, threads);
+    if (check) {
+        const auto other = enumerate(ups, check, memo_log2);
+        report(other, check);
+        for (size_t i = 0; i < result.deals.size(); i++) {
+            if (std::memcmp(&result.deals[i].ev, &other.deals[i].ev, sizeof(double))) {
+                const auto& d = result.deals[i];
+                std::cerr << "EVs of " << card_names[d.first - 1] << card_names[d.second - 1] << " against "
+                          << card_names[d.up - 1] << " differ: " << d.ev << " and " << other.deals[i].ev << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        std::cout << "same EVs, " << check << " threads took " << std::setprecision(2) << other.seconds / result.seconds
+                  << "x the time of " << threads << std::endl;
+    }
+    return EXIT_SUCCESS;
+}
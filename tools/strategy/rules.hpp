@@ -0,0 +1,101 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+// The contract's rules for the analysis tools: 8 decks, european no hole card, dealer stands on soft 17,
+// double on hard 9-11 only (after a split as well), one split, one card on each split ace.
+// Cards are counted by weight, suits don't matter to the main game.
+namespace blackjack { namespace rules {
+
+const int decks = 8;
+// card weights 1 (ace) .. 10
+const int weights = 10;
+
+// numbers of cards by weight, index 0 is unused
+using counts_t = std::array<int, weights + 1>;
+
+struct hand {
+    counts_t counts{};
+    int cards = 0;
+    int hard = 0;
+
+    int total() const {
+        return counts[1] && hard + 10 <= 21 ? hard + 10 : hard;
+    }
+    bool is_hard() const {
+        return total() == hard;
+    }
+    hand add(int w) const {
+        hand h = *this;
+        h.counts[w]++;
+        h.cards++;
+        h.hard += w;
+        return h;
+    }
+    // 5 bits per weight is enough for 21 aces
+    uint64_t key() const {
+        uint64_t k = 0;
+        for (int w = 1; w <= weights; w++) {
+            k = (k << 5) | counts[w];
+        }
+        return k;
+    }
+};
+
+struct shoe {
+    counts_t counts{};
+    int size = 0;
+
+    static shoe full() {
+        shoe s;
+        for (int w = 1; w <= weights; w++) {
+            s.counts[w] = w == 10 ? 16 * decks : 4 * decks;
+            s.size += s.counts[w];
+        }
+        return s;
+    }
+    void remove(const hand& h) {
+        for (int w = 1; w <= weights; w++) {
+            counts[w] -= h.counts[w];
+        }
+        size -= h.cards;
+    }
+    double p(int w) const {
+        return double(counts[w]) / size;
+    }
+};
+
+// dealer's final totals: 17..21, blackjack, bust
+using dealer_probs_t = std::array<double, 7>;
+const int dealer_bj = 5;
+const int dealer_bust = 6;
+
+inline void dealer_draw(shoe& s, int hard, bool ace, int cards, double p, dealer_probs_t& probs) {
+    const int total = ace && hard + 10 <= 21 ? hard + 10 : hard;
+    if (hard > 21) {
+        probs[dealer_bust] += p;
+        return;
+    }
+    if (total >= 17) {
+        probs[cards == 2 && total == 21 ? dealer_bj : total - 17] += p;
+        return;
+    }
+    for (int w = 1; w <= weights; w++) {
+        if (!s.counts[w]) {
+            continue;
+        }
+        const double q = s.p(w);
+        s.counts[w]--;
+        s.size--;
+        dealer_draw(s, hard + w, ace || w == 1, cards + 1, p * q, probs);
+        s.counts[w]++;
+        s.size++;
+    }
+}
+
+inline bool can_double(const hand& h) {
+    return h.cards == 2 && 9 <= h.hard && h.hard <= 11 && h.is_hard();
+}
+
+}} // ns blackjack::rules
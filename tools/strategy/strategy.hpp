@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+#include "strategy_table.hpp"
+
+// Lookups into the generated optimal strategy, see strategy_gen.cpp
+namespace blackjack { namespace strategy {
+
+// the same codes as blackjack::decision
+const uint8_t hit = 0;
+const uint8_t stand = 1;
+const uint8_t split = 2;
+const uint8_t double_down = 3;
+
+const uint16_t bust = 0xffff;
+const uint16_t empty_hand = 0;
+
+// weights are 1 (ace) .. 10
+inline uint16_t add_card(uint16_t hand, int weight) {
+    return hand == bust ? bust : next[hand][weight - 1];
+}
+
+inline uint8_t decide(uint16_t hand, int up_weight, bool can_split) {
+    const auto d = decisions[hand][up_weight - 1];
+    return can_split ? d & 0xf : d >> 4;
+}
+
+// works for any cards with get_weight() found by ADL, i.e. card_game::card
+template <typename Cards, typename Card>
+uint8_t decide(const Cards& cards, const Card& up_card, bool can_split) {
+    uint16_t hand = empty_hand;
+    for (const auto& c : cards) {
+        hand = add_card(hand, get_weight(c));
+    }
+    return hand == bust ? stand : decide(hand, get_weight(up_card), can_split);
+}
+
+}} // ns blackjack::strategy
@@ -0,0 +1,428 @@
+// Generates the composition-dependent optimal strategy for the contract's rules:
+// 8 decks, european no hole card, dealer stands on soft 17, double on hard 9-11 only
+// (after a split as well), one split, one card on each split ace.
+//
+// It also writes the total dependent decision EVs used by the contract's hint action.
+//
+// Usage: strategy_gen <strategy_table.hpp> <ev_table.hpp> [strategy_table.bin]
+
+#include <array>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "rules.hpp"
+
+namespace {
+
+using namespace blackjack::rules;
+
+// decision codes are the same as blackjack::decision
+const uint8_t hit = 0;
+const uint8_t stand = 1;
+const uint8_t split = 2;
+const uint8_t double_down = 3;
+
+const uint16_t bust = 0xffff;
+
+// EVs of a hand against one up card, with some cards already out of the shoe
+class evaluator {
+public:
+    evaluator(int up, const hand& removed): up(up), removed(removed) {}
+
+    shoe shoe_for(const hand& h) const {
+        auto s = shoe::full();
+        s.remove(h);
+        s.remove(removed);
+        s.counts[up]--;
+        s.size--;
+        return s;
+    }
+
+    // player's hand is never a blackjack here, so any dealer's blackjack beats it
+    double stand_ev(const hand& h) {
+        if (h.hard > 21) {
+            return -1;
+        }
+        auto it = stand_cache.find(h.key());
+        if (it != stand_cache.end()) {
+            return it->second;
+        }
+        auto s = shoe_for(h);
+        dealer_probs_t probs{};
+        dealer_draw(s, up, up == 1, 1, 1., probs);
+        const int t = h.total();
+        double ev = probs[dealer_bust] - probs[dealer_bj];
+        for (int d = 17; d <= 21; d++) {
+            ev += t > d ? probs[d - 17] : t < d ? -probs[d - 17] : 0;
+        }
+        return stand_cache[h.key()] = ev;
+    }
+
+    // the best of standing and hitting once the player has hit, 21 stands automatically
+    double play_ev(const hand& h) {
+        if (h.hard > 21) {
+            return -1;
+        }
+        if (h.total() == 21) {
+            return stand_ev(h);
+        }
+        auto it = play_cache.find(h.key());
+        if (it != play_cache.end()) {
+            return it->second;
+        }
+        return play_cache[h.key()] = std::max(stand_ev(h), hit_ev(h));
+    }
+
+    double hit_ev(const hand& h) {
+        const auto s = shoe_for(h);
+        double ev = 0;
+        for (int w = 1; w <= weights; w++) {
+            if (s.counts[w]) {
+                ev += s.p(w) * play_ev(h.add(w));
+            }
+        }
+        return ev;
+    }
+
+    double double_ev(const hand& h) {
+        const auto s = shoe_for(h);
+        double ev = 0;
+        for (int w = 1; w <= weights; w++) {
+            if (s.counts[w]) {
+                ev += s.p(w) * stand_ev(h.add(w));
+            }
+        }
+        return 2 * ev;
+    }
+
+private:
+    int up;
+    hand removed;
+    std::map<uint64_t, double> stand_cache;
+    std::map<uint64_t, double> play_cache;
+};
+
+// EV of one hand after splitting a pair of w, hands are treated as independent
+double split_hand_ev(int up, int w) {
+    hand other;
+    other = other.add(w);
+    evaluator ev(up, other);
+    hand h;
+    h = h.add(w);
+    const auto s = ev.shoe_for(h);
+    double res = 0;
+    for (int c = 1; c <= weights; c++) {
+        if (!s.counts[c]) {
+            continue;
+        }
+        const auto next = h.add(c);
+        double v;
+        if (w == 1 || next.total() == 21) {
+            // one card on each split ace, 21 stands automatically
+            v = ev.stand_ev(next);
+        } else {
+            v = ev.play_ev(next);
+            if (can_double(next)) {
+                v = std::max(v, ev.double_ev(next));
+            }
+        }
+        res += s.p(c) * v;
+    }
+    return res;
+}
+
+// Total dependent EVs for the contract's decision hints. Player's cards aren't removed from the shoe,
+// so a hand is described by its hard total and whether it has an ace.
+class total_evaluator {
+public:
+    explicit total_evaluator(int up): s(shoe::full()) {
+        s.counts[up]--;
+        s.size--;
+        auto dealer_shoe = s;
+        dealer_draw(dealer_shoe, up, up == 1, 1, 1., probs);
+    }
+
+    static int total(int hard, bool ace) {
+        return ace && hard + 10 <= 21 ? hard + 10 : hard;
+    }
+
+    double stand_ev(int hard, bool ace) const {
+        if (hard > 21) {
+            return -1;
+        }
+        const int t = total(hard, ace);
+        double ev = probs[dealer_bust] - probs[dealer_bj];
+        for (int d = 17; d <= 21; d++) {
+            ev += t > d ? probs[d - 17] : t < d ? -probs[d - 17] : 0;
+        }
+        return ev;
+    }
+
+    double play_ev(int hard, bool ace) {
+        if (hard > 21) {
+            return -1;
+        }
+        if (total(hard, ace) == 21) {
+            return stand_ev(hard, ace);
+        }
+        return std::max(stand_ev(hard, ace), hit_ev(hard, ace));
+    }
+
+    double hit_ev(int hard, bool ace) {
+        auto& cached = hit_cache[hard][ace];
+        if (cached) {
+            return *cached;
+        }
+        double ev = 0;
+        for (int w = 1; w <= weights; w++) {
+            ev += s.p(w) * play_ev(hard + w, ace || w == 1);
+        }
+        return *(cached = ev);
+    }
+
+    double double_ev(int hard, bool ace) const {
+        double ev = 0;
+        for (int w = 1; w <= weights; w++) {
+            ev += s.p(w) * stand_ev(hard + w, ace || w == 1);
+        }
+        return 2 * ev;
+    }
+
+    double split_ev(int w) {
+        double ev = 0;
+        for (int c = 1; c <= weights; c++) {
+            const int hard = w + c;
+            const bool ace = w == 1 || c == 1;
+            double v;
+            if (w == 1 || total(hard, ace) == 21) {
+                v = stand_ev(hard, ace);
+            } else {
+                v = play_ev(hard, ace);
+                if (!ace && 9 <= hard && hard <= 11) {
+                    v = std::max(v, double_ev(hard, ace));
+                }
+            }
+            ev += s.p(c) * v;
+        }
+        return 2 * ev;
+    }
+
+private:
+    shoe s;
+    dealer_probs_t probs{};
+    std::array<std::array<std::optional<double>, 2>, 32> hit_cache;
+};
+
+// hand classes of the hints table: hard 4-21, soft 12-21, pairs of aces .. tens
+const int hard_classes = 18;
+const int soft_classes = 10;
+const int classes_count = hard_classes + soft_classes + weights;
+const int16_t unavailable = INT16_MIN;
+
+// EVs in 1/10000 of the stake, by hand class, up card weight - 1 and decision
+using ev_table_t = std::vector<std::array<std::array<int16_t, 4>, weights>>;
+
+ev_table_t build_ev_table() {
+    ev_table_t table(classes_count);
+    auto to_fixed = [](double ev) {
+        return int16_t(std::lround(ev * 10000));
+    };
+    for (int up = 1; up <= weights; up++) {
+        total_evaluator ev(up);
+        for (int c = 0; c < classes_count; c++) {
+            int hard;
+            bool ace;
+            int pair = 0;
+            if (c < hard_classes) {
+                hard = c + 4;
+                ace = false;
+            } else if (c < hard_classes + soft_classes) {
+                hard = c - hard_classes + 2;
+                ace = true;
+            } else {
+                pair = c - hard_classes - soft_classes + 1;
+                hard = 2 * pair;
+                ace = pair == 1;
+            }
+            auto& evs = table[c][up - 1];
+            evs[stand] = to_fixed(ev.stand_ev(hard, ace));
+            evs[hit] = ev.total(hard, ace) < 21 ? to_fixed(ev.hit_ev(hard, ace)) : unavailable;
+            evs[double_down] = !ace && 9 <= hard && hard <= 11 ? to_fixed(ev.double_ev(hard, ace)) : unavailable;
+            evs[split] = pair ? to_fixed(ev.split_ev(pair)) : unavailable;
+        }
+    }
+    return table;
+}
+
+void write_ev_header(const ev_table_t& table, const char* path) {
+    std::ofstream out(path);
+    out << "// Generated by tools/strategy/strategy_gen, do not edit.\n"
+        << "#pragma once\n\n"
+        << "#include <cstdint>\n\n"
+        << "namespace blackjack { namespace hint {\n\n"
+        << "const int hard_classes = " << hard_classes << ";\n"
+        << "const int soft_classes = " << soft_classes << ";\n"
+        << "const int classes_count = " << classes_count << ";\n\n"
+        << "// EVs in 1/10000 of the stake by hand class (hard 4-21, soft 12-21, pairs A-T), up card weight - 1\n"
+        << "// and decision (hit, stand, split, double down), INT16_MIN if the decision isn't allowed\n"
+        << "const int16_t evs[classes_count][10][4] = {\n";
+    for (const auto& row : table) {
+        out << "    {";
+        for (int up = 0; up < weights; up++) {
+            out << (up ? "," : "") << "{";
+            for (int d = 0; d < 4; d++) {
+                out << (d ? "," : "") << (row[up][d] == unavailable ? std::string("INT16_MIN") : std::to_string(row[up][d]));
+            }
+            out << "}";
+        }
+        out << "},\n";
+    }
+    out << "};\n\n"
+        << "}} // ns blackjack::hint\n";
+}
+
+struct node {
+    hand h;
+    std::array<uint16_t, weights> next;
+    // best decision in the low nibble, the best one without a split in the high nibble
+    std::array<uint8_t, weights> decisions;
+};
+
+std::vector<node> build_nodes() {
+    std::vector<node> nodes(1);
+    std::map<uint64_t, uint16_t> index{{nodes[0].h.key(), 0}};
+    // breadth first, so a hand always comes after the hands it's made from
+    for (size_t i = 0; i < nodes.size(); i++) {
+        for (int w = 1; w <= weights; w++) {
+            const auto h = nodes[i].h.add(w);
+            if (h.hard > 21) {
+                nodes[i].next[w - 1] = bust;
+                continue;
+            }
+            auto it = index.find(h.key());
+            if (it == index.end()) {
+                it = index.emplace(h.key(), nodes.size()).first;
+                nodes.push_back(node{h, {}, {}});
+            }
+            nodes[i].next[w - 1] = it->second;
+        }
+    }
+    return nodes;
+}
+
+void solve(std::vector<node>& nodes) {
+    for (int up = 1; up <= weights; up++) {
+        evaluator ev(up, hand{});
+        std::array<double, weights + 1> split_ev{};
+        for (int w = 1; w <= weights; w++) {
+            split_ev[w] = 2 * split_hand_ev(up, w);
+        }
+        for (auto& n : nodes) {
+            const auto& h = n.h;
+            uint8_t best = stand, best_no_split = stand;
+            if (h.cards >= 2 && h.total() < 21) {
+                double best_ev = ev.stand_ev(h);
+                const double hit_ev = ev.hit_ev(h);
+                if (hit_ev > best_ev) {
+                    best = hit;
+                    best_ev = hit_ev;
+                }
+                if (can_double(h)) {
+                    const double double_ev = ev.double_ev(h);
+                    if (double_ev > best_ev) {
+                        best = double_down;
+                        best_ev = double_ev;
+                    }
+                }
+                best_no_split = best;
+                if (h.cards == 2) {
+                    for (int w = 1; w <= weights; w++) {
+                        if (h.counts[w] == 2 && split_ev[w] > best_ev) {
+                            best = split;
+                        }
+                    }
+                }
+            }
+            n.decisions[up - 1] = best | (best_no_split << 4);
+        }
+        std::cerr << "up card " << up << " done\n";
+    }
+}
+
+void write_header(const std::vector<node>& nodes, const char* path) {
+    std::ofstream out(path);
+    out << "// Generated by tools/strategy/strategy_gen, do not edit.\n"
+        << "#pragma once\n\n"
+        << "#include <cstdint>\n\n"
+        << "namespace blackjack { namespace strategy {\n\n"
+        << "const uint16_t nodes_count = " << nodes.size() << ";\n\n"
+        << "// hand a card of weight w + 1 leads to, 0xffff is a bust\n"
+        << "const uint16_t next[nodes_count][10] = {\n";
+    for (const auto& n : nodes) {
+        out << "    {";
+        for (int w = 0; w < weights; w++) {
+            out << (w ? "," : "") << n.next[w];
+        }
+        out << "},\n";
+    }
+    out << "};\n\n"
+        << "// by up card weight - 1: best decision in the low nibble, best decision without a split in the high one\n"
+        << "const uint8_t decisions[nodes_count][10] = {\n";
+    for (const auto& n : nodes) {
+        out << "    {";
+        for (int w = 0; w < weights; w++) {
+            char buf[8];
+            std::snprintf(buf, sizeof(buf), "0x%02x", n.decisions[w]);
+            out << (w ? "," : "") << buf;
+        }
+        out << "},\n";
+    }
+    out << "};\n\n"
+        << "}} // ns blackjack::strategy\n";
+}
+
+// layout: "BJST", u16 version, u16 nodes count, next table (u16 LE), decisions (u8)
+void write_binary(const std::vector<node>& nodes, const char* path) {
+    std::ofstream out(path, std::ios::binary);
+    auto put16 = [&](uint16_t v) {
+        out.put(char(v & 0xff));
+        out.put(char(v >> 8));
+    };
+    out.write("BJST", 4);
+    put16(1);
+    put16(nodes.size());
+    for (const auto& n : nodes) {
+        for (auto v : n.next) {
+            put16(v);
+        }
+    }
+    for (const auto& n : nodes) {
+        out.write(reinterpret_cast<const char*>(n.decisions.data()), weights);
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    if (argc < 3) {
+        std::cerr << "usage: " << argv[0] << " <strategy_table.hpp> <ev_table.hpp> [strategy_table.bin]\n";
+        return 1;
+    }
+    auto nodes = build_nodes();
+    std::cerr << nodes.size() << " hands\n";
+    solve(nodes);
+    write_header(nodes, argv[1]);
+    write_ev_header(build_ev_table(), argv[2]);
+    if (argc > 3) {
+        write_binary(nodes, argv[3]);
+    }
+    return 0;
+}
@@ -0,0 +1,6184 @@
+// Generated by tools/strategy/strategy_gen, do not edit.
+#pragma once
+
+#include <cstdint>
+
+namespace blackjack { namespace strategy {
+
+const uint16_t nodes_count = 3083;
+
+// hand a card of weight w + 1 leads to, 0xffff is a bust
+const uint16_t next[nodes_count][10] = {
+    {1,2,3,4,5,6,7,8,9,10},
+    {11,12,13,14,15,16,17,18,19,20},
+    {12,21,22,23,24,25,26,27,28,29},
+    {13,22,30,31,32,33,34,35,36,37},
+    {14,23,31,38,39,40,41,42,43,44},
+    {15,24,32,39,45,46,47,48,49,50},
+    {16,25,33,40,46,51,52,53,54,55},
+    {17,26,34,41,47,52,56,57,58,59},
+    {18,27,35,42,48,53,57,60,61,62},
+    {19,28,36,43,49,54,58,61,63,64},
+    {20,29,37,44,50,55,59,62,64,65},
+    {66,67,68,69,70,71,72,73,74,75},
+    {67,76,77,78,79,80,81,82,83,84},
+    {68,77,85,86,87,88,89,90,91,92},
+    {69,78,86,93,94,95,96,97,98,99},
+    {70,79,87,94,100,101,102,103,104,105},
+    {71,80,88,95,101,106,107,108,109,110},
+    {72,81,89,96,102,107,111,112,113,114},
+    {73,82,90,97,103,108,112,115,116,117},
+    {74,83,91,98,104,109,113,116,118,119},
+    {75,84,92,99,105,110,114,117,119,120},
+    {76,121,122,123,124,125,126,127,128,129},
+    {77,122,130,131,132,133,134,135,136,137},
+    {78,123,131,138,139,140,141,142,143,144},
+    {79,124,132,139,145,146,147,148,149,150},
+    {80,125,133,140,146,151,152,153,154,155},
+    {81,126,134,141,147,152,156,157,158,159},
+    {82,127,135,142,148,153,157,160,161,162},
+    {83,128,136,143,149,154,158,161,163,164},
+    {84,129,137,144,150,155,159,162,164,65535},
+    {85,130,165,166,167,168,169,170,171,172},
+    {86,131,166,173,174,175,176,177,178,179},
+    {87,132,167,174,180,181,182,183,184,185},
+    {88,133,168,175,181,186,187,188,189,190},
+    {89,134,169,176,182,187,191,192,193,194},
+    {90,135,170,177,183,188,192,195,196,197},
+    {91,136,171,178,184,189,193,196,198,65535},
+    {92,137,172,179,185,190,194,197,65535,65535},
+    {93,138,173,199,200,201,202,203,204,205},
+    {94,139,174,200,206,207,208,209,210,211},
+    {95,140,175,201,207,212,213,214,215,216},
+    {96,141,176,202,208,213,217,218,219,220},
+    {97,142,177,203,209,214,218,221,222,65535},
+    {98,143,178,204,210,215,219,222,65535,65535},
+    {99,144,179,205,211,216,220,65535,65535,65535},
+    {100,145,180,206,223,224,225,226,227,228},
+    {101,146,181,207,224,229,230,231,232,233},
+    {102,147,182,208,225,230,234,235,236,65535},
+    {103,148,183,209,226,231,235,237,65535,65535},
+    {104,149,184,210,227,232,236,65535,65535,65535},
+    {105,150,185,211,228,233,65535,65535,65535,65535},
+    {106,151,186,212,229,238,239,240,241,65535},
+    {107,152,187,213,230,239,242,243,65535,65535},
+    {108,153,188,214,231,240,243,65535,65535,65535},
+    {109,154,189,215,232,241,65535,65535,65535,65535},
+    {110,155,190,216,233,65535,65535,65535,65535,65535},
+    {111,156,191,217,234,242,244,65535,65535,65535},
+    {112,157,192,218,235,243,65535,65535,65535,65535},
+    {113,158,193,219,236,65535,65535,65535,65535,65535},
+    {114,159,194,220,65535,65535,65535,65535,65535,65535},
+    {115,160,195,221,237,65535,65535,65535,65535,65535},
+    {116,161,196,222,65535,65535,65535,65535,65535,65535},
+    {117,162,197,65535,65535,65535,65535,65535,65535,65535},
+    {118,163,198,65535,65535,65535,65535,65535,65535,65535},
+    {119,164,65535,65535,65535,65535,65535,65535,65535,65535},
+    {120,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {245,246,247,248,249,250,251,252,253,254},
+    {246,255,256,257,258,259,260,261,262,263},
+    {247,256,264,265,266,267,268,269,270,271},
+    {248,257,265,272,273,274,275,276,277,278},
+    {249,258,266,273,279,280,281,282,283,284},
+    {250,259,267,274,280,285,286,287,288,289},
+    {251,260,268,275,281,286,290,291,292,293},
+    {252,261,269,276,282,287,291,294,295,296},
+    {253,262,270,277,283,288,292,295,297,298},
+    {254,263,271,278,284,289,293,296,298,65535},
+    {255,299,300,301,302,303,304,305,306,307},
+    {256,300,308,309,310,311,312,313,314,315},
+    {257,301,309,316,317,318,319,320,321,322},
+    {258,302,310,317,323,324,325,326,327,328},
+    {259,303,311,318,324,329,330,331,332,333},
+    {260,304,312,319,325,330,334,335,336,337},
+    {261,305,313,320,326,331,335,338,339,340},
+    {262,306,314,321,327,332,336,339,341,65535},
+    {263,307,315,322,328,333,337,340,65535,65535},
+    {264,308,342,343,344,345,346,347,348,349},
+    {265,309,343,350,351,352,353,354,355,356},
+    {266,310,344,351,357,358,359,360,361,362},
+    {267,311,345,352,358,363,364,365,366,367},
+    {268,312,346,353,359,364,368,369,370,371},
+    {269,313,347,354,360,365,369,372,373,65535},
+    {270,314,348,355,361,366,370,373,65535,65535},
+    {271,315,349,356,362,367,371,65535,65535,65535},
+    {272,316,350,374,375,376,377,378,379,380},
+    {273,317,351,375,381,382,383,384,385,386},
+    {274,318,352,376,382,387,388,389,390,391},
+    {275,319,353,377,383,388,392,393,394,65535},
+    {276,320,354,378,384,389,393,395,65535,65535},
+    {277,321,355,379,385,390,394,65535,65535,65535},
+    {278,322,356,380,386,391,65535,65535,65535,65535},
+    {279,323,357,381,396,397,398,399,400,401},
+    {280,324,358,382,397,402,403,404,405,65535},
+    {281,325,359,383,398,403,406,407,65535,65535},
+    {282,326,360,384,399,404,407,65535,65535,65535},
+    {283,327,361,385,400,405,65535,65535,65535,65535},
+    {284,328,362,386,401,65535,65535,65535,65535,65535},
+    {285,329,363,387,402,408,409,410,65535,65535},
+    {286,330,364,388,403,409,411,65535,65535,65535},
+    {287,331,365,389,404,410,65535,65535,65535,65535},
+    {288,332,366,390,405,65535,65535,65535,65535,65535},
+    {289,333,367,391,65535,65535,65535,65535,65535,65535},
+    {290,334,368,392,406,411,65535,65535,65535,65535},
+    {291,335,369,393,407,65535,65535,65535,65535,65535},
+    {292,336,370,394,65535,65535,65535,65535,65535,65535},
+    {293,337,371,65535,65535,65535,65535,65535,65535,65535},
+    {294,338,372,395,65535,65535,65535,65535,65535,65535},
+    {295,339,373,65535,65535,65535,65535,65535,65535,65535},
+    {296,340,65535,65535,65535,65535,65535,65535,65535,65535},
+    {297,341,65535,65535,65535,65535,65535,65535,65535,65535},
+    {298,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {299,412,413,414,415,416,417,418,419,420},
+    {300,413,421,422,423,424,425,426,427,428},
+    {301,414,422,429,430,431,432,433,434,435},
+    {302,415,423,430,436,437,438,439,440,441},
+    {303,416,424,431,437,442,443,444,445,446},
+    {304,417,425,432,438,443,447,448,449,450},
+    {305,418,426,433,439,444,448,451,452,65535},
+    {306,419,427,434,440,445,449,452,65535,65535},
+    {307,420,428,435,441,446,450,65535,65535,65535},
+    {308,421,453,454,455,456,457,458,459,460},
+    {309,422,454,461,462,463,464,465,466,467},
+    {310,423,455,462,468,469,470,471,472,473},
+    {311,424,456,463,469,474,475,476,477,478},
+    {312,425,457,464,470,475,479,480,481,65535},
+    {313,426,458,465,471,476,480,482,65535,65535},
+    {314,427,459,466,472,477,481,65535,65535,65535},
+    {315,428,460,467,473,478,65535,65535,65535,65535},
+    {316,429,461,483,484,485,486,487,488,489},
+    {317,430,462,484,490,491,492,493,494,495},
+    {318,431,463,485,491,496,497,498,499,65535},
+    {319,432,464,486,492,497,500,501,65535,65535},
+    {320,433,465,487,493,498,501,65535,65535,65535},
+    {321,434,466,488,494,499,65535,65535,65535,65535},
+    {322,435,467,489,495,65535,65535,65535,65535,65535},
+    {323,436,468,490,502,503,504,505,506,65535},
+    {324,437,469,491,503,507,508,509,65535,65535},
+    {325,438,470,492,504,508,510,65535,65535,65535},
+    {326,439,471,493,505,509,65535,65535,65535,65535},
+    {327,440,472,494,506,65535,65535,65535,65535,65535},
+    {328,441,473,495,65535,65535,65535,65535,65535,65535},
+    {329,442,474,496,507,511,512,65535,65535,65535},
+    {330,443,475,497,508,512,65535,65535,65535,65535},
+    {331,444,476,498,509,65535,65535,65535,65535,65535},
+    {332,445,477,499,65535,65535,65535,65535,65535,65535},
+    {333,446,478,65535,65535,65535,65535,65535,65535,65535},
+    {334,447,479,500,510,65535,65535,65535,65535,65535},
+    {335,448,480,501,65535,65535,65535,65535,65535,65535},
+    {336,449,481,65535,65535,65535,65535,65535,65535,65535},
+    {337,450,65535,65535,65535,65535,65535,65535,65535,65535},
+    {338,451,482,65535,65535,65535,65535,65535,65535,65535},
+    {339,452,65535,65535,65535,65535,65535,65535,65535,65535},
+    {340,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {341,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {342,453,513,514,515,516,517,518,519,520},
+    {343,454,514,521,522,523,524,525,526,527},
+    {344,455,515,522,528,529,530,531,532,533},
+    {345,456,516,523,529,534,535,536,537,65535},
+    {346,457,517,524,530,535,538,539,65535,65535},
+    {347,458,518,525,531,536,539,65535,65535,65535},
+    {348,459,519,526,532,537,65535,65535,65535,65535},
+    {349,460,520,527,533,65535,65535,65535,65535,65535},
+    {350,461,521,540,541,542,543,544,545,546},
+    {351,462,522,541,547,548,549,550,551,65535},
+    {352,463,523,542,548,552,553,554,65535,65535},
+    {353,464,524,543,549,553,555,65535,65535,65535},
+    {354,465,525,544,550,554,65535,65535,65535,65535},
+    {355,466,526,545,551,65535,65535,65535,65535,65535},
+    {356,467,527,546,65535,65535,65535,65535,65535,65535},
+    {357,468,528,547,556,557,558,559,65535,65535},
+    {358,469,529,548,557,560,561,65535,65535,65535},
+    {359,470,530,549,558,561,65535,65535,65535,65535},
+    {360,471,531,550,559,65535,65535,65535,65535,65535},
+    {361,472,532,551,65535,65535,65535,65535,65535,65535},
+    {362,473,533,65535,65535,65535,65535,65535,65535,65535},
+    {363,474,534,552,560,562,65535,65535,65535,65535},
+    {364,475,535,553,561,65535,65535,65535,65535,65535},
+    {365,476,536,554,65535,65535,65535,65535,65535,65535},
+    {366,477,537,65535,65535,65535,65535,65535,65535,65535},
+    {367,478,65535,65535,65535,65535,65535,65535,65535,65535},
+    {368,479,538,555,65535,65535,65535,65535,65535,65535},
+    {369,480,539,65535,65535,65535,65535,65535,65535,65535},
+    {370,481,65535,65535,65535,65535,65535,65535,65535,65535},
+    {371,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {372,482,65535,65535,65535,65535,65535,65535,65535,65535},
+    {373,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {374,483,540,563,564,565,566,567,568,65535},
+    {375,484,541,564,569,570,571,572,65535,65535},
+    {376,485,542,565,570,573,574,65535,65535,65535},
+    {377,486,543,566,571,574,65535,65535,65535,65535},
+    {378,487,544,567,572,65535,65535,65535,65535,65535},
+    {379,488,545,568,65535,65535,65535,65535,65535,65535},
+    {380,489,546,65535,65535,65535,65535,65535,65535,65535},
+    {381,490,547,569,575,576,577,65535,65535,65535},
+    {382,491,548,570,576,578,65535,65535,65535,65535},
+    {383,492,549,571,577,65535,65535,65535,65535,65535},
+    {384,493,550,572,65535,65535,65535,65535,65535,65535},
+    {385,494,551,65535,65535,65535,65535,65535,65535,65535},
+    {386,495,65535,65535,65535,65535,65535,65535,65535,65535},
+    {387,496,552,573,578,65535,65535,65535,65535,65535},
+    {388,497,553,574,65535,65535,65535,65535,65535,65535},
+    {389,498,554,65535,65535,65535,65535,65535,65535,65535},
+    {390,499,65535,65535,65535,65535,65535,65535,65535,65535},
+    {391,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {392,500,555,65535,65535,65535,65535,65535,65535,65535},
+    {393,501,65535,65535,65535,65535,65535,65535,65535,65535},
+    {394,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {395,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {396,502,556,575,579,580,65535,65535,65535,65535},
+    {397,503,557,576,580,65535,65535,65535,65535,65535},
+    {398,504,558,577,65535,65535,65535,65535,65535,65535},
+    {399,505,559,65535,65535,65535,65535,65535,65535,65535},
+    {400,506,65535,65535,65535,65535,65535,65535,65535,65535},
+    {401,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {402,507,560,578,65535,65535,65535,65535,65535,65535},
+    {403,508,561,65535,65535,65535,65535,65535,65535,65535},
+    {404,509,65535,65535,65535,65535,65535,65535,65535,65535},
+    {405,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {406,510,65535,65535,65535,65535,65535,65535,65535,65535},
+    {407,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {408,511,562,65535,65535,65535,65535,65535,65535,65535},
+    {409,512,65535,65535,65535,65535,65535,65535,65535,65535},
+    {410,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {411,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {581,582,583,584,585,586,587,588,589,590},
+    {582,591,592,593,594,595,596,597,598,599},
+    {583,592,600,601,602,603,604,605,606,607},
+    {584,593,601,608,609,610,611,612,613,614},
+    {585,594,602,609,615,616,617,618,619,620},
+    {586,595,603,610,616,621,622,623,624,625},
+    {587,596,604,611,617,622,626,627,628,629},
+    {588,597,605,612,618,623,627,630,631,632},
+    {589,598,606,613,619,624,628,631,633,65535},
+    {590,599,607,614,620,625,629,632,65535,65535},
+    {591,634,635,636,637,638,639,640,641,642},
+    {592,635,643,644,645,646,647,648,649,650},
+    {593,636,644,651,652,653,654,655,656,657},
+    {594,637,645,652,658,659,660,661,662,663},
+    {595,638,646,653,659,664,665,666,667,668},
+    {596,639,647,654,660,665,669,670,671,672},
+    {597,640,648,655,661,666,670,673,674,65535},
+    {598,641,649,656,662,667,671,674,65535,65535},
+    {599,642,650,657,663,668,672,65535,65535,65535},
+    {600,643,675,676,677,678,679,680,681,682},
+    {601,644,676,683,684,685,686,687,688,689},
+    {602,645,677,684,690,691,692,693,694,695},
+    {603,646,678,685,691,696,697,698,699,700},
+    {604,647,679,686,692,697,701,702,703,65535},
+    {605,648,680,687,693,698,702,704,65535,65535},
+    {606,649,681,688,694,699,703,65535,65535,65535},
+    {607,650,682,689,695,700,65535,65535,65535,65535},
+    {608,651,683,705,706,707,708,709,710,711},
+    {609,652,684,706,712,713,714,715,716,717},
+    {610,653,685,707,713,718,719,720,721,65535},
+    {611,654,686,708,714,719,722,723,65535,65535},
+    {612,655,687,709,715,720,723,65535,65535,65535},
+    {613,656,688,710,716,721,65535,65535,65535,65535},
+    {614,657,689,711,717,65535,65535,65535,65535,65535},
+    {615,658,690,712,724,725,726,727,728,65535},
+    {616,659,691,713,725,729,730,731,65535,65535},
+    {617,660,692,714,726,730,732,65535,65535,65535},
+    {618,661,693,715,727,731,65535,65535,65535,65535},
+    {619,662,694,716,728,65535,65535,65535,65535,65535},
+    {620,663,695,717,65535,65535,65535,65535,65535,65535},
+    {621,664,696,718,729,733,734,65535,65535,65535},
+    {622,665,697,719,730,734,65535,65535,65535,65535},
+    {623,666,698,720,731,65535,65535,65535,65535,65535},
+    {624,667,699,721,65535,65535,65535,65535,65535,65535},
+    {625,668,700,65535,65535,65535,65535,65535,65535,65535},
+    {626,669,701,722,732,65535,65535,65535,65535,65535},
+    {627,670,702,723,65535,65535,65535,65535,65535,65535},
+    {628,671,703,65535,65535,65535,65535,65535,65535,65535},
+    {629,672,65535,65535,65535,65535,65535,65535,65535,65535},
+    {630,673,704,65535,65535,65535,65535,65535,65535,65535},
+    {631,674,65535,65535,65535,65535,65535,65535,65535,65535},
+    {632,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {633,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {634,735,736,737,738,739,740,741,742,743},
+    {635,736,744,745,746,747,748,749,750,751},
+    {636,737,745,752,753,754,755,756,757,758},
+    {637,738,746,753,759,760,761,762,763,764},
+    {638,739,747,754,760,765,766,767,768,769},
+    {639,740,748,755,761,766,770,771,772,65535},
+    {640,741,749,756,762,767,771,773,65535,65535},
+    {641,742,750,757,763,768,772,65535,65535,65535},
+    {642,743,751,758,764,769,65535,65535,65535,65535},
+    {643,744,774,775,776,777,778,779,780,781},
+    {644,745,775,782,783,784,785,786,787,788},
+    {645,746,776,783,789,790,791,792,793,794},
+    {646,747,777,784,790,795,796,797,798,65535},
+    {647,748,778,785,791,796,799,800,65535,65535},
+    {648,749,779,786,792,797,800,65535,65535,65535},
+    {649,750,780,787,793,798,65535,65535,65535,65535},
+    {650,751,781,788,794,65535,65535,65535,65535,65535},
+    {651,752,782,801,802,803,804,805,806,807},
+    {652,753,783,802,808,809,810,811,812,65535},
+    {653,754,784,803,809,813,814,815,65535,65535},
+    {654,755,785,804,810,814,816,65535,65535,65535},
+    {655,756,786,805,811,815,65535,65535,65535,65535},
+    {656,757,787,806,812,65535,65535,65535,65535,65535},
+    {657,758,788,807,65535,65535,65535,65535,65535,65535},
+    {658,759,789,808,817,818,819,820,65535,65535},
+    {659,760,790,809,818,821,822,65535,65535,65535},
+    {660,761,791,810,819,822,65535,65535,65535,65535},
+    {661,762,792,811,820,65535,65535,65535,65535,65535},
+    {662,763,793,812,65535,65535,65535,65535,65535,65535},
+    {663,764,794,65535,65535,65535,65535,65535,65535,65535},
+    {664,765,795,813,821,823,65535,65535,65535,65535},
+    {665,766,796,814,822,65535,65535,65535,65535,65535},
+    {666,767,797,815,65535,65535,65535,65535,65535,65535},
+    {667,768,798,65535,65535,65535,65535,65535,65535,65535},
+    {668,769,65535,65535,65535,65535,65535,65535,65535,65535},
+    {669,770,799,816,65535,65535,65535,65535,65535,65535},
+    {670,771,800,65535,65535,65535,65535,65535,65535,65535},
+    {671,772,65535,65535,65535,65535,65535,65535,65535,65535},
+    {672,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {673,773,65535,65535,65535,65535,65535,65535,65535,65535},
+    {674,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {675,774,824,825,826,827,828,829,830,831},
+    {676,775,825,832,833,834,835,836,837,838},
+    {677,776,826,833,839,840,841,842,843,65535},
+    {678,777,827,834,840,844,845,846,65535,65535},
+    {679,778,828,835,841,845,847,65535,65535,65535},
+    {680,779,829,836,842,846,65535,65535,65535,65535},
+    {681,780,830,837,843,65535,65535,65535,65535,65535},
+    {682,781,831,838,65535,65535,65535,65535,65535,65535},
+    {683,782,832,848,849,850,851,852,853,65535},
+    {684,783,833,849,854,855,856,857,65535,65535},
+    {685,784,834,850,855,858,859,65535,65535,65535},
+    {686,785,835,851,856,859,65535,65535,65535,65535},
+    {687,786,836,852,857,65535,65535,65535,65535,65535},
+    {688,787,837,853,65535,65535,65535,65535,65535,65535},
+    {689,788,838,65535,65535,65535,65535,65535,65535,65535},
+    {690,789,839,854,860,861,862,65535,65535,65535},
+    {691,790,840,855,861,863,65535,65535,65535,65535},
+    {692,791,841,856,862,65535,65535,65535,65535,65535},
+    {693,792,842,857,65535,65535,65535,65535,65535,65535},
+    {694,793,843,65535,65535,65535,65535,65535,65535,65535},
+    {695,794,65535,65535,65535,65535,65535,65535,65535,65535},
+    {696,795,844,858,863,65535,65535,65535,65535,65535},
+    {697,796,845,859,65535,65535,65535,65535,65535,65535},
+    {698,797,846,65535,65535,65535,65535,65535,65535,65535},
+    {699,798,65535,65535,65535,65535,65535,65535,65535,65535},
+    {700,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {701,799,847,65535,65535,65535,65535,65535,65535,65535},
+    {702,800,65535,65535,65535,65535,65535,65535,65535,65535},
+    {703,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {704,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {705,801,848,864,865,866,867,868,65535,65535},
+    {706,802,849,865,869,870,871,65535,65535,65535},
+    {707,803,850,866,870,872,65535,65535,65535,65535},
+    {708,804,851,867,871,65535,65535,65535,65535,65535},
+    {709,805,852,868,65535,65535,65535,65535,65535,65535},
+    {710,806,853,65535,65535,65535,65535,65535,65535,65535},
+    {711,807,65535,65535,65535,65535,65535,65535,65535,65535},
+    {712,808,854,869,873,874,65535,65535,65535,65535},
+    {713,809,855,870,874,65535,65535,65535,65535,65535},
+    {714,810,856,871,65535,65535,65535,65535,65535,65535},
+    {715,811,857,65535,65535,65535,65535,65535,65535,65535},
+    {716,812,65535,65535,65535,65535,65535,65535,65535,65535},
+    {717,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {718,813,858,872,65535,65535,65535,65535,65535,65535},
+    {719,814,859,65535,65535,65535,65535,65535,65535,65535},
+    {720,815,65535,65535,65535,65535,65535,65535,65535,65535},
+    {721,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {722,816,65535,65535,65535,65535,65535,65535,65535,65535},
+    {723,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {724,817,860,873,875,65535,65535,65535,65535,65535},
+    {725,818,861,874,65535,65535,65535,65535,65535,65535},
+    {726,819,862,65535,65535,65535,65535,65535,65535,65535},
+    {727,820,65535,65535,65535,65535,65535,65535,65535,65535},
+    {728,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {729,821,863,65535,65535,65535,65535,65535,65535,65535},
+    {730,822,65535,65535,65535,65535,65535,65535,65535,65535},
+    {731,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {732,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {733,823,65535,65535,65535,65535,65535,65535,65535,65535},
+    {734,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {735,876,877,878,879,880,881,882,883,884},
+    {736,877,885,886,887,888,889,890,891,892},
+    {737,878,886,893,894,895,896,897,898,899},
+    {738,879,887,894,900,901,902,903,904,905},
+    {739,880,888,895,901,906,907,908,909,65535},
+    {740,881,889,896,902,907,910,911,65535,65535},
+    {741,882,890,897,903,908,911,65535,65535,65535},
+    {742,883,891,898,904,909,65535,65535,65535,65535},
+    {743,884,892,899,905,65535,65535,65535,65535,65535},
+    {744,885,912,913,914,915,916,917,918,919},
+    {745,886,913,920,921,922,923,924,925,926},
+    {746,887,914,921,927,928,929,930,931,65535},
+    {747,888,915,922,928,932,933,934,65535,65535},
+    {748,889,916,923,929,933,935,65535,65535,65535},
+    {749,890,917,924,930,934,65535,65535,65535,65535},
+    {750,891,918,925,931,65535,65535,65535,65535,65535},
+    {751,892,919,926,65535,65535,65535,65535,65535,65535},
+    {752,893,920,936,937,938,939,940,941,65535},
+    {753,894,921,937,942,943,944,945,65535,65535},
+    {754,895,922,938,943,946,947,65535,65535,65535},
+    {755,896,923,939,944,947,65535,65535,65535,65535},
+    {756,897,924,940,945,65535,65535,65535,65535,65535},
+    {757,898,925,941,65535,65535,65535,65535,65535,65535},
+    {758,899,926,65535,65535,65535,65535,65535,65535,65535},
+    {759,900,927,942,948,949,950,65535,65535,65535},
+    {760,901,928,943,949,951,65535,65535,65535,65535},
+    {761,902,929,944,950,65535,65535,65535,65535,65535},
+    {762,903,930,945,65535,65535,65535,65535,65535,65535},
+    {763,904,931,65535,65535,65535,65535,65535,65535,65535},
+    {764,905,65535,65535,65535,65535,65535,65535,65535,65535},
+    {765,906,932,946,951,65535,65535,65535,65535,65535},
+    {766,907,933,947,65535,65535,65535,65535,65535,65535},
+    {767,908,934,65535,65535,65535,65535,65535,65535,65535},
+    {768,909,65535,65535,65535,65535,65535,65535,65535,65535},
+    {769,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {770,910,935,65535,65535,65535,65535,65535,65535,65535},
+    {771,911,65535,65535,65535,65535,65535,65535,65535,65535},
+    {772,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {773,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {774,912,952,953,954,955,956,957,958,959},
+    {775,913,953,960,961,962,963,964,965,65535},
+    {776,914,954,961,966,967,968,969,65535,65535},
+    {777,915,955,962,967,970,971,65535,65535,65535},
+    {778,916,956,963,968,971,65535,65535,65535,65535},
+    {779,917,957,964,969,65535,65535,65535,65535,65535},
+    {780,918,958,965,65535,65535,65535,65535,65535,65535},
+    {781,919,959,65535,65535,65535,65535,65535,65535,65535},
+    {782,920,960,972,973,974,975,976,65535,65535},
+    {783,921,961,973,977,978,979,65535,65535,65535},
+    {784,922,962,974,978,980,65535,65535,65535,65535},
+    {785,923,963,975,979,65535,65535,65535,65535,65535},
+    {786,924,964,976,65535,65535,65535,65535,65535,65535},
+    {787,925,965,65535,65535,65535,65535,65535,65535,65535},
+    {788,926,65535,65535,65535,65535,65535,65535,65535,65535},
+    {789,927,966,977,981,982,65535,65535,65535,65535},
+    {790,928,967,978,982,65535,65535,65535,65535,65535},
+    {791,929,968,979,65535,65535,65535,65535,65535,65535},
+    {792,930,969,65535,65535,65535,65535,65535,65535,65535},
+    {793,931,65535,65535,65535,65535,65535,65535,65535,65535},
+    {794,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {795,932,970,980,65535,65535,65535,65535,65535,65535},
+    {796,933,971,65535,65535,65535,65535,65535,65535,65535},
+    {797,934,65535,65535,65535,65535,65535,65535,65535,65535},
+    {798,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {799,935,65535,65535,65535,65535,65535,65535,65535,65535},
+    {800,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {801,936,972,983,984,985,986,65535,65535,65535},
+    {802,937,973,984,987,988,65535,65535,65535,65535},
+    {803,938,974,985,988,65535,65535,65535,65535,65535},
+    {804,939,975,986,65535,65535,65535,65535,65535,65535},
+    {805,940,976,65535,65535,65535,65535,65535,65535,65535},
+    {806,941,65535,65535,65535,65535,65535,65535,65535,65535},
+    {807,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {808,942,977,987,989,65535,65535,65535,65535,65535},
+    {809,943,978,988,65535,65535,65535,65535,65535,65535},
+    {810,944,979,65535,65535,65535,65535,65535,65535,65535},
+    {811,945,65535,65535,65535,65535,65535,65535,65535,65535},
+    {812,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {813,946,980,65535,65535,65535,65535,65535,65535,65535},
+    {814,947,65535,65535,65535,65535,65535,65535,65535,65535},
+    {815,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {816,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {817,948,981,989,65535,65535,65535,65535,65535,65535},
+    {818,949,982,65535,65535,65535,65535,65535,65535,65535},
+    {819,950,65535,65535,65535,65535,65535,65535,65535,65535},
+    {820,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {821,951,65535,65535,65535,65535,65535,65535,65535,65535},
+    {822,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {823,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {824,952,990,991,992,993,994,995,996,65535},
+    {825,953,991,997,998,999,1000,1001,65535,65535},
+    {826,954,992,998,1002,1003,1004,65535,65535,65535},
+    {827,955,993,999,1003,1005,65535,65535,65535,65535},
+    {828,956,994,1000,1004,65535,65535,65535,65535,65535},
+    {829,957,995,1001,65535,65535,65535,65535,65535,65535},
+    {830,958,996,65535,65535,65535,65535,65535,65535,65535},
+    {831,959,65535,65535,65535,65535,65535,65535,65535,65535},
+    {832,960,997,1006,1007,1008,1009,65535,65535,65535},
+    {833,961,998,1007,1010,1011,65535,65535,65535,65535},
+    {834,962,999,1008,1011,65535,65535,65535,65535,65535},
+    {835,963,1000,1009,65535,65535,65535,65535,65535,65535},
+    {836,964,1001,65535,65535,65535,65535,65535,65535,65535},
+    {837,965,65535,65535,65535,65535,65535,65535,65535,65535},
+    {838,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {839,966,1002,1010,1012,65535,65535,65535,65535,65535},
+    {840,967,1003,1011,65535,65535,65535,65535,65535,65535},
+    {841,968,1004,65535,65535,65535,65535,65535,65535,65535},
+    {842,969,65535,65535,65535,65535,65535,65535,65535,65535},
+    {843,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {844,970,1005,65535,65535,65535,65535,65535,65535,65535},
+    {845,971,65535,65535,65535,65535,65535,65535,65535,65535},
+    {846,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {847,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {848,972,1006,1013,1014,1015,65535,65535,65535,65535},
+    {849,973,1007,1014,1016,65535,65535,65535,65535,65535},
+    {850,974,1008,1015,65535,65535,65535,65535,65535,65535},
+    {851,975,1009,65535,65535,65535,65535,65535,65535,65535},
+    {852,976,65535,65535,65535,65535,65535,65535,65535,65535},
+    {853,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {854,977,1010,1016,65535,65535,65535,65535,65535,65535},
+    {855,978,1011,65535,65535,65535,65535,65535,65535,65535},
+    {856,979,65535,65535,65535,65535,65535,65535,65535,65535},
+    {857,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {858,980,65535,65535,65535,65535,65535,65535,65535,65535},
+    {859,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {860,981,1012,65535,65535,65535,65535,65535,65535,65535},
+    {861,982,65535,65535,65535,65535,65535,65535,65535,65535},
+    {862,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {863,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {864,983,1013,1017,1018,65535,65535,65535,65535,65535},
+    {865,984,1014,1018,65535,65535,65535,65535,65535,65535},
+    {866,985,1015,65535,65535,65535,65535,65535,65535,65535},
+    {867,986,65535,65535,65535,65535,65535,65535,65535,65535},
+    {868,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {869,987,1016,65535,65535,65535,65535,65535,65535,65535},
+    {870,988,65535,65535,65535,65535,65535,65535,65535,65535},
+    {871,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {872,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {873,989,65535,65535,65535,65535,65535,65535,65535,65535},
+    {874,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {875,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1019,1020,1021,1022,1023,1024,1025,1026,1027,1028},
+    {1020,1029,1030,1031,1032,1033,1034,1035,1036,1037},
+    {1021,1030,1038,1039,1040,1041,1042,1043,1044,1045},
+    {1022,1031,1039,1046,1047,1048,1049,1050,1051,1052},
+    {1023,1032,1040,1047,1053,1054,1055,1056,1057,1058},
+    {1024,1033,1041,1048,1054,1059,1060,1061,1062,1063},
+    {1025,1034,1042,1049,1055,1060,1064,1065,1066,1067},
+    {1026,1035,1043,1050,1056,1061,1065,1068,1069,65535},
+    {1027,1036,1044,1051,1057,1062,1066,1069,65535,65535},
+    {1028,1037,1045,1052,1058,1063,1067,65535,65535,65535},
+    {1029,1070,1071,1072,1073,1074,1075,1076,1077,1078},
+    {1030,1071,1079,1080,1081,1082,1083,1084,1085,1086},
+    {1031,1072,1080,1087,1088,1089,1090,1091,1092,1093},
+    {1032,1073,1081,1088,1094,1095,1096,1097,1098,1099},
+    {1033,1074,1082,1089,1095,1100,1101,1102,1103,1104},
+    {1034,1075,1083,1090,1096,1101,1105,1106,1107,65535},
+    {1035,1076,1084,1091,1097,1102,1106,1108,65535,65535},
+    {1036,1077,1085,1092,1098,1103,1107,65535,65535,65535},
+    {1037,1078,1086,1093,1099,1104,65535,65535,65535,65535},
+    {1038,1079,1109,1110,1111,1112,1113,1114,1115,1116},
+    {1039,1080,1110,1117,1118,1119,1120,1121,1122,1123},
+    {1040,1081,1111,1118,1124,1125,1126,1127,1128,1129},
+    {1041,1082,1112,1119,1125,1130,1131,1132,1133,65535},
+    {1042,1083,1113,1120,1126,1131,1134,1135,65535,65535},
+    {1043,1084,1114,1121,1127,1132,1135,65535,65535,65535},
+    {1044,1085,1115,1122,1128,1133,65535,65535,65535,65535},
+    {1045,1086,1116,1123,1129,65535,65535,65535,65535,65535},
+    {1046,1087,1117,1136,1137,1138,1139,1140,1141,1142},
+    {1047,1088,1118,1137,1143,1144,1145,1146,1147,65535},
+    {1048,1089,1119,1138,1144,1148,1149,1150,65535,65535},
+    {1049,1090,1120,1139,1145,1149,1151,65535,65535,65535},
+    {1050,1091,1121,1140,1146,1150,65535,65535,65535,65535},
+    {1051,1092,1122,1141,1147,65535,65535,65535,65535,65535},
+    {1052,1093,1123,1142,65535,65535,65535,65535,65535,65535},
+    {1053,1094,1124,1143,1152,1153,1154,1155,65535,65535},
+    {1054,1095,1125,1144,1153,1156,1157,65535,65535,65535},
+    {1055,1096,1126,1145,1154,1157,65535,65535,65535,65535},
+    {1056,1097,1127,1146,1155,65535,65535,65535,65535,65535},
+    {1057,1098,1128,1147,65535,65535,65535,65535,65535,65535},
+    {1058,1099,1129,65535,65535,65535,65535,65535,65535,65535},
+    {1059,1100,1130,1148,1156,1158,65535,65535,65535,65535},
+    {1060,1101,1131,1149,1157,65535,65535,65535,65535,65535},
+    {1061,1102,1132,1150,65535,65535,65535,65535,65535,65535},
+    {1062,1103,1133,65535,65535,65535,65535,65535,65535,65535},
+    {1063,1104,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1064,1105,1134,1151,65535,65535,65535,65535,65535,65535},
+    {1065,1106,1135,65535,65535,65535,65535,65535,65535,65535},
+    {1066,1107,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1067,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1068,1108,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1069,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1070,1159,1160,1161,1162,1163,1164,1165,1166,1167},
+    {1071,1160,1168,1169,1170,1171,1172,1173,1174,1175},
+    {1072,1161,1169,1176,1177,1178,1179,1180,1181,1182},
+    {1073,1162,1170,1177,1183,1184,1185,1186,1187,1188},
+    {1074,1163,1171,1178,1184,1189,1190,1191,1192,65535},
+    {1075,1164,1172,1179,1185,1190,1193,1194,65535,65535},
+    {1076,1165,1173,1180,1186,1191,1194,65535,65535,65535},
+    {1077,1166,1174,1181,1187,1192,65535,65535,65535,65535},
+    {1078,1167,1175,1182,1188,65535,65535,65535,65535,65535},
+    {1079,1168,1195,1196,1197,1198,1199,1200,1201,1202},
+    {1080,1169,1196,1203,1204,1205,1206,1207,1208,1209},
+    {1081,1170,1197,1204,1210,1211,1212,1213,1214,65535},
+    {1082,1171,1198,1205,1211,1215,1216,1217,65535,65535},
+    {1083,1172,1199,1206,1212,1216,1218,65535,65535,65535},
+    {1084,1173,1200,1207,1213,1217,65535,65535,65535,65535},
+    {1085,1174,1201,1208,1214,65535,65535,65535,65535,65535},
+    {1086,1175,1202,1209,65535,65535,65535,65535,65535,65535},
+    {1087,1176,1203,1219,1220,1221,1222,1223,1224,65535},
+    {1088,1177,1204,1220,1225,1226,1227,1228,65535,65535},
+    {1089,1178,1205,1221,1226,1229,1230,65535,65535,65535},
+    {1090,1179,1206,1222,1227,1230,65535,65535,65535,65535},
+    {1091,1180,1207,1223,1228,65535,65535,65535,65535,65535},
+    {1092,1181,1208,1224,65535,65535,65535,65535,65535,65535},
+    {1093,1182,1209,65535,65535,65535,65535,65535,65535,65535},
+    {1094,1183,1210,1225,1231,1232,1233,65535,65535,65535},
+    {1095,1184,1211,1226,1232,1234,65535,65535,65535,65535},
+    {1096,1185,1212,1227,1233,65535,65535,65535,65535,65535},
+    {1097,1186,1213,1228,65535,65535,65535,65535,65535,65535},
+    {1098,1187,1214,65535,65535,65535,65535,65535,65535,65535},
+    {1099,1188,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1100,1189,1215,1229,1234,65535,65535,65535,65535,65535},
+    {1101,1190,1216,1230,65535,65535,65535,65535,65535,65535},
+    {1102,1191,1217,65535,65535,65535,65535,65535,65535,65535},
+    {1103,1192,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1104,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1105,1193,1218,65535,65535,65535,65535,65535,65535,65535},
+    {1106,1194,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1107,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1108,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1109,1195,1235,1236,1237,1238,1239,1240,1241,1242},
+    {1110,1196,1236,1243,1244,1245,1246,1247,1248,65535},
+    {1111,1197,1237,1244,1249,1250,1251,1252,65535,65535},
+    {1112,1198,1238,1245,1250,1253,1254,65535,65535,65535},
+    {1113,1199,1239,1246,1251,1254,65535,65535,65535,65535},
+    {1114,1200,1240,1247,1252,65535,65535,65535,65535,65535},
+    {1115,1201,1241,1248,65535,65535,65535,65535,65535,65535},
+    {1116,1202,1242,65535,65535,65535,65535,65535,65535,65535},
+    {1117,1203,1243,1255,1256,1257,1258,1259,65535,65535},
+    {1118,1204,1244,1256,1260,1261,1262,65535,65535,65535},
+    {1119,1205,1245,1257,1261,1263,65535,65535,65535,65535},
+    {1120,1206,1246,1258,1262,65535,65535,65535,65535,65535},
+    {1121,1207,1247,1259,65535,65535,65535,65535,65535,65535},
+    {1122,1208,1248,65535,65535,65535,65535,65535,65535,65535},
+    {1123,1209,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1124,1210,1249,1260,1264,1265,65535,65535,65535,65535},
+    {1125,1211,1250,1261,1265,65535,65535,65535,65535,65535},
+    {1126,1212,1251,1262,65535,65535,65535,65535,65535,65535},
+    {1127,1213,1252,65535,65535,65535,65535,65535,65535,65535},
+    {1128,1214,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1129,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1130,1215,1253,1263,65535,65535,65535,65535,65535,65535},
+    {1131,1216,1254,65535,65535,65535,65535,65535,65535,65535},
+    {1132,1217,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1133,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1134,1218,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1135,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1136,1219,1255,1266,1267,1268,1269,65535,65535,65535},
+    {1137,1220,1256,1267,1270,1271,65535,65535,65535,65535},
+    {1138,1221,1257,1268,1271,65535,65535,65535,65535,65535},
+    {1139,1222,1258,1269,65535,65535,65535,65535,65535,65535},
+    {1140,1223,1259,65535,65535,65535,65535,65535,65535,65535},
+    {1141,1224,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1142,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1143,1225,1260,1270,1272,65535,65535,65535,65535,65535},
+    {1144,1226,1261,1271,65535,65535,65535,65535,65535,65535},
+    {1145,1227,1262,65535,65535,65535,65535,65535,65535,65535},
+    {1146,1228,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1147,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1148,1229,1263,65535,65535,65535,65535,65535,65535,65535},
+    {1149,1230,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1150,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1151,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1152,1231,1264,1272,65535,65535,65535,65535,65535,65535},
+    {1153,1232,1265,65535,65535,65535,65535,65535,65535,65535},
+    {1154,1233,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1155,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1156,1234,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1157,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1158,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1159,1273,1274,1275,1276,1277,1278,1279,1280,1281},
+    {1160,1274,1282,1283,1284,1285,1286,1287,1288,1289},
+    {1161,1275,1283,1290,1291,1292,1293,1294,1295,1296},
+    {1162,1276,1284,1291,1297,1298,1299,1300,1301,65535},
+    {1163,1277,1285,1292,1298,1302,1303,1304,65535,65535},
+    {1164,1278,1286,1293,1299,1303,1305,65535,65535,65535},
+    {1165,1279,1287,1294,1300,1304,65535,65535,65535,65535},
+    {1166,1280,1288,1295,1301,65535,65535,65535,65535,65535},
+    {1167,1281,1289,1296,65535,65535,65535,65535,65535,65535},
+    {1168,1282,1306,1307,1308,1309,1310,1311,1312,1313},
+    {1169,1283,1307,1314,1315,1316,1317,1318,1319,65535},
+    {1170,1284,1308,1315,1320,1321,1322,1323,65535,65535},
+    {1171,1285,1309,1316,1321,1324,1325,65535,65535,65535},
+    {1172,1286,1310,1317,1322,1325,65535,65535,65535,65535},
+    {1173,1287,1311,1318,1323,65535,65535,65535,65535,65535},
+    {1174,1288,1312,1319,65535,65535,65535,65535,65535,65535},
+    {1175,1289,1313,65535,65535,65535,65535,65535,65535,65535},
+    {1176,1290,1314,1326,1327,1328,1329,1330,65535,65535},
+    {1177,1291,1315,1327,1331,1332,1333,65535,65535,65535},
+    {1178,1292,1316,1328,1332,1334,65535,65535,65535,65535},
+    {1179,1293,1317,1329,1333,65535,65535,65535,65535,65535},
+    {1180,1294,1318,1330,65535,65535,65535,65535,65535,65535},
+    {1181,1295,1319,65535,65535,65535,65535,65535,65535,65535},
+    {1182,1296,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1183,1297,1320,1331,1335,1336,65535,65535,65535,65535},
+    {1184,1298,1321,1332,1336,65535,65535,65535,65535,65535},
+    {1185,1299,1322,1333,65535,65535,65535,65535,65535,65535},
+    {1186,1300,1323,65535,65535,65535,65535,65535,65535,65535},
+    {1187,1301,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1188,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1189,1302,1324,1334,65535,65535,65535,65535,65535,65535},
+    {1190,1303,1325,65535,65535,65535,65535,65535,65535,65535},
+    {1191,1304,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1192,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1193,1305,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1194,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1195,1306,1337,1338,1339,1340,1341,1342,1343,65535},
+    {1196,1307,1338,1344,1345,1346,1347,1348,65535,65535},
+    {1197,1308,1339,1345,1349,1350,1351,65535,65535,65535},
+    {1198,1309,1340,1346,1350,1352,65535,65535,65535,65535},
+    {1199,1310,1341,1347,1351,65535,65535,65535,65535,65535},
+    {1200,1311,1342,1348,65535,65535,65535,65535,65535,65535},
+    {1201,1312,1343,65535,65535,65535,65535,65535,65535,65535},
+    {1202,1313,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1203,1314,1344,1353,1354,1355,1356,65535,65535,65535},
+    {1204,1315,1345,1354,1357,1358,65535,65535,65535,65535},
+    {1205,1316,1346,1355,1358,65535,65535,65535,65535,65535},
+    {1206,1317,1347,1356,65535,65535,65535,65535,65535,65535},
+    {1207,1318,1348,65535,65535,65535,65535,65535,65535,65535},
+    {1208,1319,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1209,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1210,1320,1349,1357,1359,65535,65535,65535,65535,65535},
+    {1211,1321,1350,1358,65535,65535,65535,65535,65535,65535},
+    {1212,1322,1351,65535,65535,65535,65535,65535,65535,65535},
+    {1213,1323,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1214,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1215,1324,1352,65535,65535,65535,65535,65535,65535,65535},
+    {1216,1325,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1217,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1218,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1219,1326,1353,1360,1361,1362,65535,65535,65535,65535},
+    {1220,1327,1354,1361,1363,65535,65535,65535,65535,65535},
+    {1221,1328,1355,1362,65535,65535,65535,65535,65535,65535},
+    {1222,1329,1356,65535,65535,65535,65535,65535,65535,65535},
+    {1223,1330,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1224,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1225,1331,1357,1363,65535,65535,65535,65535,65535,65535},
+    {1226,1332,1358,65535,65535,65535,65535,65535,65535,65535},
+    {1227,1333,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1228,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1229,1334,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1230,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1231,1335,1359,65535,65535,65535,65535,65535,65535,65535},
+    {1232,1336,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1233,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1234,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1235,1337,1364,1365,1366,1367,1368,1369,65535,65535},
+    {1236,1338,1365,1370,1371,1372,1373,65535,65535,65535},
+    {1237,1339,1366,1371,1374,1375,65535,65535,65535,65535},
+    {1238,1340,1367,1372,1375,65535,65535,65535,65535,65535},
+    {1239,1341,1368,1373,65535,65535,65535,65535,65535,65535},
+    {1240,1342,1369,65535,65535,65535,65535,65535,65535,65535},
+    {1241,1343,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1242,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1243,1344,1370,1376,1377,1378,65535,65535,65535,65535},
+    {1244,1345,1371,1377,1379,65535,65535,65535,65535,65535},
+    {1245,1346,1372,1378,65535,65535,65535,65535,65535,65535},
+    {1246,1347,1373,65535,65535,65535,65535,65535,65535,65535},
+    {1247,1348,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1248,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1249,1349,1374,1379,65535,65535,65535,65535,65535,65535},
+    {1250,1350,1375,65535,65535,65535,65535,65535,65535,65535},
+    {1251,1351,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1252,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1253,1352,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1254,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1255,1353,1376,1380,1381,65535,65535,65535,65535,65535},
+    {1256,1354,1377,1381,65535,65535,65535,65535,65535,65535},
+    {1257,1355,1378,65535,65535,65535,65535,65535,65535,65535},
+    {1258,1356,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1259,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1260,1357,1379,65535,65535,65535,65535,65535,65535,65535},
+    {1261,1358,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1262,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1263,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1264,1359,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1265,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1266,1360,1380,1382,65535,65535,65535,65535,65535,65535},
+    {1267,1361,1381,65535,65535,65535,65535,65535,65535,65535},
+    {1268,1362,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1269,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1270,1363,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1271,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1272,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1273,1383,1384,1385,1386,1387,1388,1389,1390,1391},
+    {1274,1384,1392,1393,1394,1395,1396,1397,1398,1399},
+    {1275,1385,1393,1400,1401,1402,1403,1404,1405,65535},
+    {1276,1386,1394,1401,1406,1407,1408,1409,65535,65535},
+    {1277,1387,1395,1402,1407,1410,1411,65535,65535,65535},
+    {1278,1388,1396,1403,1408,1411,65535,65535,65535,65535},
+    {1279,1389,1397,1404,1409,65535,65535,65535,65535,65535},
+    {1280,1390,1398,1405,65535,65535,65535,65535,65535,65535},
+    {1281,1391,1399,65535,65535,65535,65535,65535,65535,65535},
+    {1282,1392,1412,1413,1414,1415,1416,1417,1418,65535},
+    {1283,1393,1413,1419,1420,1421,1422,1423,65535,65535},
+    {1284,1394,1414,1420,1424,1425,1426,65535,65535,65535},
+    {1285,1395,1415,1421,1425,1427,65535,65535,65535,65535},
+    {1286,1396,1416,1422,1426,65535,65535,65535,65535,65535},
+    {1287,1397,1417,1423,65535,65535,65535,65535,65535,65535},
+    {1288,1398,1418,65535,65535,65535,65535,65535,65535,65535},
+    {1289,1399,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1290,1400,1419,1428,1429,1430,1431,65535,65535,65535},
+    {1291,1401,1420,1429,1432,1433,65535,65535,65535,65535},
+    {1292,1402,1421,1430,1433,65535,65535,65535,65535,65535},
+    {1293,1403,1422,1431,65535,65535,65535,65535,65535,65535},
+    {1294,1404,1423,65535,65535,65535,65535,65535,65535,65535},
+    {1295,1405,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1296,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1297,1406,1424,1432,1434,65535,65535,65535,65535,65535},
+    {1298,1407,1425,1433,65535,65535,65535,65535,65535,65535},
+    {1299,1408,1426,65535,65535,65535,65535,65535,65535,65535},
+    {1300,1409,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1301,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1302,1410,1427,65535,65535,65535,65535,65535,65535,65535},
+    {1303,1411,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1304,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1305,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1306,1412,1435,1436,1437,1438,1439,1440,65535,65535},
+    {1307,1413,1436,1441,1442,1443,1444,65535,65535,65535},
+    {1308,1414,1437,1442,1445,1446,65535,65535,65535,65535},
+    {1309,1415,1438,1443,1446,65535,65535,65535,65535,65535},
+    {1310,1416,1439,1444,65535,65535,65535,65535,65535,65535},
+    {1311,1417,1440,65535,65535,65535,65535,65535,65535,65535},
+    {1312,1418,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1313,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1314,1419,1441,1447,1448,1449,65535,65535,65535,65535},
+    {1315,1420,1442,1448,1450,65535,65535,65535,65535,65535},
+    {1316,1421,1443,1449,65535,65535,65535,65535,65535,65535},
+    {1317,1422,1444,65535,65535,65535,65535,65535,65535,65535},
+    {1318,1423,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1319,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1320,1424,1445,1450,65535,65535,65535,65535,65535,65535},
+    {1321,1425,1446,65535,65535,65535,65535,65535,65535,65535},
+    {1322,1426,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1323,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1324,1427,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1325,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1326,1428,1447,1451,1452,65535,65535,65535,65535,65535},
+    {1327,1429,1448,1452,65535,65535,65535,65535,65535,65535},
+    {1328,1430,1449,65535,65535,65535,65535,65535,65535,65535},
+    {1329,1431,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1330,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1331,1432,1450,65535,65535,65535,65535,65535,65535,65535},
+    {1332,1433,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1333,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1334,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1335,1434,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1336,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1337,1435,1453,1454,1455,1456,1457,65535,65535,65535},
+    {1338,1436,1454,1458,1459,1460,65535,65535,65535,65535},
+    {1339,1437,1455,1459,1461,65535,65535,65535,65535,65535},
+    {1340,1438,1456,1460,65535,65535,65535,65535,65535,65535},
+    {1341,1439,1457,65535,65535,65535,65535,65535,65535,65535},
+    {1342,1440,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1343,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1344,1441,1458,1462,1463,65535,65535,65535,65535,65535},
+    {1345,1442,1459,1463,65535,65535,65535,65535,65535,65535},
+    {1346,1443,1460,65535,65535,65535,65535,65535,65535,65535},
+    {1347,1444,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1348,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1349,1445,1461,65535,65535,65535,65535,65535,65535,65535},
+    {1350,1446,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1351,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1352,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1353,1447,1462,1464,65535,65535,65535,65535,65535,65535},
+    {1354,1448,1463,65535,65535,65535,65535,65535,65535,65535},
+    {1355,1449,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1356,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1357,1450,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1358,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1359,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1360,1451,1464,65535,65535,65535,65535,65535,65535,65535},
+    {1361,1452,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1362,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1363,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1364,1453,1465,1466,1467,1468,65535,65535,65535,65535},
+    {1365,1454,1466,1469,1470,65535,65535,65535,65535,65535},
+    {1366,1455,1467,1470,65535,65535,65535,65535,65535,65535},
+    {1367,1456,1468,65535,65535,65535,65535,65535,65535,65535},
+    {1368,1457,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1369,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1370,1458,1469,1471,65535,65535,65535,65535,65535,65535},
+    {1371,1459,1470,65535,65535,65535,65535,65535,65535,65535},
+    {1372,1460,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1373,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1374,1461,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1375,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1376,1462,1471,65535,65535,65535,65535,65535,65535,65535},
+    {1377,1463,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1378,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1379,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1380,1464,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1381,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1382,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1472,1473,1474,1475,1476,1477,1478,1479,1480,1481},
+    {1473,1482,1483,1484,1485,1486,1487,1488,1489,1490},
+    {1474,1483,1491,1492,1493,1494,1495,1496,1497,1498},
+    {1475,1484,1492,1499,1500,1501,1502,1503,1504,1505},
+    {1476,1485,1493,1500,1506,1507,1508,1509,1510,1511},
+    {1477,1486,1494,1501,1507,1512,1513,1514,1515,1516},
+    {1478,1487,1495,1502,1508,1513,1517,1518,1519,65535},
+    {1479,1488,1496,1503,1509,1514,1518,1520,65535,65535},
+    {1480,1489,1497,1504,1510,1515,1519,65535,65535,65535},
+    {1481,1490,1498,1505,1511,1516,65535,65535,65535,65535},
+    {1482,1521,1522,1523,1524,1525,1526,1527,1528,1529},
+    {1483,1522,1530,1531,1532,1533,1534,1535,1536,1537},
+    {1484,1523,1531,1538,1539,1540,1541,1542,1543,1544},
+    {1485,1524,1532,1539,1545,1546,1547,1548,1549,1550},
+    {1486,1525,1533,1540,1546,1551,1552,1553,1554,65535},
+    {1487,1526,1534,1541,1547,1552,1555,1556,65535,65535},
+    {1488,1527,1535,1542,1548,1553,1556,65535,65535,65535},
+    {1489,1528,1536,1543,1549,1554,65535,65535,65535,65535},
+    {1490,1529,1537,1544,1550,65535,65535,65535,65535,65535},
+    {1491,1530,1557,1558,1559,1560,1561,1562,1563,1564},
+    {1492,1531,1558,1565,1566,1567,1568,1569,1570,1571},
+    {1493,1532,1559,1566,1572,1573,1574,1575,1576,65535},
+    {1494,1533,1560,1567,1573,1577,1578,1579,65535,65535},
+    {1495,1534,1561,1568,1574,1578,1580,65535,65535,65535},
+    {1496,1535,1562,1569,1575,1579,65535,65535,65535,65535},
+    {1497,1536,1563,1570,1576,65535,65535,65535,65535,65535},
+    {1498,1537,1564,1571,65535,65535,65535,65535,65535,65535},
+    {1499,1538,1565,1581,1582,1583,1584,1585,1586,65535},
+    {1500,1539,1566,1582,1587,1588,1589,1590,65535,65535},
+    {1501,1540,1567,1583,1588,1591,1592,65535,65535,65535},
+    {1502,1541,1568,1584,1589,1592,65535,65535,65535,65535},
+    {1503,1542,1569,1585,1590,65535,65535,65535,65535,65535},
+    {1504,1543,1570,1586,65535,65535,65535,65535,65535,65535},
+    {1505,1544,1571,65535,65535,65535,65535,65535,65535,65535},
+    {1506,1545,1572,1587,1593,1594,1595,65535,65535,65535},
+    {1507,1546,1573,1588,1594,1596,65535,65535,65535,65535},
+    {1508,1547,1574,1589,1595,65535,65535,65535,65535,65535},
+    {1509,1548,1575,1590,65535,65535,65535,65535,65535,65535},
+    {1510,1549,1576,65535,65535,65535,65535,65535,65535,65535},
+    {1511,1550,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1512,1551,1577,1591,1596,65535,65535,65535,65535,65535},
+    {1513,1552,1578,1592,65535,65535,65535,65535,65535,65535},
+    {1514,1553,1579,65535,65535,65535,65535,65535,65535,65535},
+    {1515,1554,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1516,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1517,1555,1580,65535,65535,65535,65535,65535,65535,65535},
+    {1518,1556,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1519,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1520,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1521,1597,1598,1599,1600,1601,1602,1603,1604,1605},
+    {1522,1598,1606,1607,1608,1609,1610,1611,1612,1613},
+    {1523,1599,1607,1614,1615,1616,1617,1618,1619,1620},
+    {1524,1600,1608,1615,1621,1622,1623,1624,1625,65535},
+    {1525,1601,1609,1616,1622,1626,1627,1628,65535,65535},
+    {1526,1602,1610,1617,1623,1627,1629,65535,65535,65535},
+    {1527,1603,1611,1618,1624,1628,65535,65535,65535,65535},
+    {1528,1604,1612,1619,1625,65535,65535,65535,65535,65535},
+    {1529,1605,1613,1620,65535,65535,65535,65535,65535,65535},
+    {1530,1606,1630,1631,1632,1633,1634,1635,1636,1637},
+    {1531,1607,1631,1638,1639,1640,1641,1642,1643,65535},
+    {1532,1608,1632,1639,1644,1645,1646,1647,65535,65535},
+    {1533,1609,1633,1640,1645,1648,1649,65535,65535,65535},
+    {1534,1610,1634,1641,1646,1649,65535,65535,65535,65535},
+    {1535,1611,1635,1642,1647,65535,65535,65535,65535,65535},
+    {1536,1612,1636,1643,65535,65535,65535,65535,65535,65535},
+    {1537,1613,1637,65535,65535,65535,65535,65535,65535,65535},
+    {1538,1614,1638,1650,1651,1652,1653,1654,65535,65535},
+    {1539,1615,1639,1651,1655,1656,1657,65535,65535,65535},
+    {1540,1616,1640,1652,1656,1658,65535,65535,65535,65535},
+    {1541,1617,1641,1653,1657,65535,65535,65535,65535,65535},
+    {1542,1618,1642,1654,65535,65535,65535,65535,65535,65535},
+    {1543,1619,1643,65535,65535,65535,65535,65535,65535,65535},
+    {1544,1620,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1545,1621,1644,1655,1659,1660,65535,65535,65535,65535},
+    {1546,1622,1645,1656,1660,65535,65535,65535,65535,65535},
+    {1547,1623,1646,1657,65535,65535,65535,65535,65535,65535},
+    {1548,1624,1647,65535,65535,65535,65535,65535,65535,65535},
+    {1549,1625,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1550,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1551,1626,1648,1658,65535,65535,65535,65535,65535,65535},
+    {1552,1627,1649,65535,65535,65535,65535,65535,65535,65535},
+    {1553,1628,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1554,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1555,1629,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1556,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1557,1630,1661,1662,1663,1664,1665,1666,1667,65535},
+    {1558,1631,1662,1668,1669,1670,1671,1672,65535,65535},
+    {1559,1632,1663,1669,1673,1674,1675,65535,65535,65535},
+    {1560,1633,1664,1670,1674,1676,65535,65535,65535,65535},
+    {1561,1634,1665,1671,1675,65535,65535,65535,65535,65535},
+    {1562,1635,1666,1672,65535,65535,65535,65535,65535,65535},
+    {1563,1636,1667,65535,65535,65535,65535,65535,65535,65535},
+    {1564,1637,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1565,1638,1668,1677,1678,1679,1680,65535,65535,65535},
+    {1566,1639,1669,1678,1681,1682,65535,65535,65535,65535},
+    {1567,1640,1670,1679,1682,65535,65535,65535,65535,65535},
+    {1568,1641,1671,1680,65535,65535,65535,65535,65535,65535},
+    {1569,1642,1672,65535,65535,65535,65535,65535,65535,65535},
+    {1570,1643,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1571,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1572,1644,1673,1681,1683,65535,65535,65535,65535,65535},
+    {1573,1645,1674,1682,65535,65535,65535,65535,65535,65535},
+    {1574,1646,1675,65535,65535,65535,65535,65535,65535,65535},
+    {1575,1647,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1576,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1577,1648,1676,65535,65535,65535,65535,65535,65535,65535},
+    {1578,1649,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1579,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1580,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1581,1650,1677,1684,1685,1686,65535,65535,65535,65535},
+    {1582,1651,1678,1685,1687,65535,65535,65535,65535,65535},
+    {1583,1652,1679,1686,65535,65535,65535,65535,65535,65535},
+    {1584,1653,1680,65535,65535,65535,65535,65535,65535,65535},
+    {1585,1654,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1586,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1587,1655,1681,1687,65535,65535,65535,65535,65535,65535},
+    {1588,1656,1682,65535,65535,65535,65535,65535,65535,65535},
+    {1589,1657,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1590,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1591,1658,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1592,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1593,1659,1683,65535,65535,65535,65535,65535,65535,65535},
+    {1594,1660,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1595,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1596,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1597,1688,1689,1690,1691,1692,1693,1694,1695,1696},
+    {1598,1689,1697,1698,1699,1700,1701,1702,1703,1704},
+    {1599,1690,1698,1705,1706,1707,1708,1709,1710,65535},
+    {1600,1691,1699,1706,1711,1712,1713,1714,65535,65535},
+    {1601,1692,1700,1707,1712,1715,1716,65535,65535,65535},
+    {1602,1693,1701,1708,1713,1716,65535,65535,65535,65535},
+    {1603,1694,1702,1709,1714,65535,65535,65535,65535,65535},
+    {1604,1695,1703,1710,65535,65535,65535,65535,65535,65535},
+    {1605,1696,1704,65535,65535,65535,65535,65535,65535,65535},
+    {1606,1697,1717,1718,1719,1720,1721,1722,1723,65535},
+    {1607,1698,1718,1724,1725,1726,1727,1728,65535,65535},
+    {1608,1699,1719,1725,1729,1730,1731,65535,65535,65535},
+    {1609,1700,1720,1726,1730,1732,65535,65535,65535,65535},
+    {1610,1701,1721,1727,1731,65535,65535,65535,65535,65535},
+    {1611,1702,1722,1728,65535,65535,65535,65535,65535,65535},
+    {1612,1703,1723,65535,65535,65535,65535,65535,65535,65535},
+    {1613,1704,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1614,1705,1724,1733,1734,1735,1736,65535,65535,65535},
+    {1615,1706,1725,1734,1737,1738,65535,65535,65535,65535},
+    {1616,1707,1726,1735,1738,65535,65535,65535,65535,65535},
+    {1617,1708,1727,1736,65535,65535,65535,65535,65535,65535},
+    {1618,1709,1728,65535,65535,65535,65535,65535,65535,65535},
+    {1619,1710,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1620,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1621,1711,1729,1737,1739,65535,65535,65535,65535,65535},
+    {1622,1712,1730,1738,65535,65535,65535,65535,65535,65535},
+    {1623,1713,1731,65535,65535,65535,65535,65535,65535,65535},
+    {1624,1714,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1625,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1626,1715,1732,65535,65535,65535,65535,65535,65535,65535},
+    {1627,1716,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1628,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1629,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1630,1717,1740,1741,1742,1743,1744,1745,65535,65535},
+    {1631,1718,1741,1746,1747,1748,1749,65535,65535,65535},
+    {1632,1719,1742,1747,1750,1751,65535,65535,65535,65535},
+    {1633,1720,1743,1748,1751,65535,65535,65535,65535,65535},
+    {1634,1721,1744,1749,65535,65535,65535,65535,65535,65535},
+    {1635,1722,1745,65535,65535,65535,65535,65535,65535,65535},
+    {1636,1723,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1637,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1638,1724,1746,1752,1753,1754,65535,65535,65535,65535},
+    {1639,1725,1747,1753,1755,65535,65535,65535,65535,65535},
+    {1640,1726,1748,1754,65535,65535,65535,65535,65535,65535},
+    {1641,1727,1749,65535,65535,65535,65535,65535,65535,65535},
+    {1642,1728,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1643,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1644,1729,1750,1755,65535,65535,65535,65535,65535,65535},
+    {1645,1730,1751,65535,65535,65535,65535,65535,65535,65535},
+    {1646,1731,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1647,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1648,1732,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1649,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1650,1733,1752,1756,1757,65535,65535,65535,65535,65535},
+    {1651,1734,1753,1757,65535,65535,65535,65535,65535,65535},
+    {1652,1735,1754,65535,65535,65535,65535,65535,65535,65535},
+    {1653,1736,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1654,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1655,1737,1755,65535,65535,65535,65535,65535,65535,65535},
+    {1656,1738,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1657,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1658,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1659,1739,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1660,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1661,1740,1758,1759,1760,1761,1762,65535,65535,65535},
+    {1662,1741,1759,1763,1764,1765,65535,65535,65535,65535},
+    {1663,1742,1760,1764,1766,65535,65535,65535,65535,65535},
+    {1664,1743,1761,1765,65535,65535,65535,65535,65535,65535},
+    {1665,1744,1762,65535,65535,65535,65535,65535,65535,65535},
+    {1666,1745,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1667,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1668,1746,1763,1767,1768,65535,65535,65535,65535,65535},
+    {1669,1747,1764,1768,65535,65535,65535,65535,65535,65535},
+    {1670,1748,1765,65535,65535,65535,65535,65535,65535,65535},
+    {1671,1749,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1672,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1673,1750,1766,65535,65535,65535,65535,65535,65535,65535},
+    {1674,1751,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1675,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1676,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1677,1752,1767,1769,65535,65535,65535,65535,65535,65535},
+    {1678,1753,1768,65535,65535,65535,65535,65535,65535,65535},
+    {1679,1754,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1680,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1681,1755,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1682,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1683,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1684,1756,1769,65535,65535,65535,65535,65535,65535,65535},
+    {1685,1757,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1686,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1687,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1688,1770,1771,1772,1773,1774,1775,1776,1777,1778},
+    {1689,1771,1779,1780,1781,1782,1783,1784,1785,65535},
+    {1690,1772,1780,1786,1787,1788,1789,1790,65535,65535},
+    {1691,1773,1781,1787,1791,1792,1793,65535,65535,65535},
+    {1692,1774,1782,1788,1792,1794,65535,65535,65535,65535},
+    {1693,1775,1783,1789,1793,65535,65535,65535,65535,65535},
+    {1694,1776,1784,1790,65535,65535,65535,65535,65535,65535},
+    {1695,1777,1785,65535,65535,65535,65535,65535,65535,65535},
+    {1696,1778,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1697,1779,1795,1796,1797,1798,1799,1800,65535,65535},
+    {1698,1780,1796,1801,1802,1803,1804,65535,65535,65535},
+    {1699,1781,1797,1802,1805,1806,65535,65535,65535,65535},
+    {1700,1782,1798,1803,1806,65535,65535,65535,65535,65535},
+    {1701,1783,1799,1804,65535,65535,65535,65535,65535,65535},
+    {1702,1784,1800,65535,65535,65535,65535,65535,65535,65535},
+    {1703,1785,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1704,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1705,1786,1801,1807,1808,1809,65535,65535,65535,65535},
+    {1706,1787,1802,1808,1810,65535,65535,65535,65535,65535},
+    {1707,1788,1803,1809,65535,65535,65535,65535,65535,65535},
+    {1708,1789,1804,65535,65535,65535,65535,65535,65535,65535},
+    {1709,1790,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1710,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1711,1791,1805,1810,65535,65535,65535,65535,65535,65535},
+    {1712,1792,1806,65535,65535,65535,65535,65535,65535,65535},
+    {1713,1793,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1714,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1715,1794,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1716,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1717,1795,1811,1812,1813,1814,1815,65535,65535,65535},
+    {1718,1796,1812,1816,1817,1818,65535,65535,65535,65535},
+    {1719,1797,1813,1817,1819,65535,65535,65535,65535,65535},
+    {1720,1798,1814,1818,65535,65535,65535,65535,65535,65535},
+    {1721,1799,1815,65535,65535,65535,65535,65535,65535,65535},
+    {1722,1800,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1723,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1724,1801,1816,1820,1821,65535,65535,65535,65535,65535},
+    {1725,1802,1817,1821,65535,65535,65535,65535,65535,65535},
+    {1726,1803,1818,65535,65535,65535,65535,65535,65535,65535},
+    {1727,1804,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1728,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1729,1805,1819,65535,65535,65535,65535,65535,65535,65535},
+    {1730,1806,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1731,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1732,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1733,1807,1820,1822,65535,65535,65535,65535,65535,65535},
+    {1734,1808,1821,65535,65535,65535,65535,65535,65535,65535},
+    {1735,1809,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1736,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1737,1810,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1738,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1739,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1740,1811,1823,1824,1825,1826,65535,65535,65535,65535},
+    {1741,1812,1824,1827,1828,65535,65535,65535,65535,65535},
+    {1742,1813,1825,1828,65535,65535,65535,65535,65535,65535},
+    {1743,1814,1826,65535,65535,65535,65535,65535,65535,65535},
+    {1744,1815,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1745,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1746,1816,1827,1829,65535,65535,65535,65535,65535,65535},
+    {1747,1817,1828,65535,65535,65535,65535,65535,65535,65535},
+    {1748,1818,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1749,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1750,1819,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1751,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1752,1820,1829,65535,65535,65535,65535,65535,65535,65535},
+    {1753,1821,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1754,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1755,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1756,1822,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1757,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1758,1823,1830,1831,1832,65535,65535,65535,65535,65535},
+    {1759,1824,1831,1833,65535,65535,65535,65535,65535,65535},
+    {1760,1825,1832,65535,65535,65535,65535,65535,65535,65535},
+    {1761,1826,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1762,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1763,1827,1833,65535,65535,65535,65535,65535,65535,65535},
+    {1764,1828,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1765,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1766,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1767,1829,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1768,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1769,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1770,1834,1835,1836,1837,1838,1839,1840,1841,65535},
+    {1771,1835,1842,1843,1844,1845,1846,1847,65535,65535},
+    {1772,1836,1843,1848,1849,1850,1851,65535,65535,65535},
+    {1773,1837,1844,1849,1852,1853,65535,65535,65535,65535},
+    {1774,1838,1845,1850,1853,65535,65535,65535,65535,65535},
+    {1775,1839,1846,1851,65535,65535,65535,65535,65535,65535},
+    {1776,1840,1847,65535,65535,65535,65535,65535,65535,65535},
+    {1777,1841,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1778,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1779,1842,1854,1855,1856,1857,1858,65535,65535,65535},
+    {1780,1843,1855,1859,1860,1861,65535,65535,65535,65535},
+    {1781,1844,1856,1860,1862,65535,65535,65535,65535,65535},
+    {1782,1845,1857,1861,65535,65535,65535,65535,65535,65535},
+    {1783,1846,1858,65535,65535,65535,65535,65535,65535,65535},
+    {1784,1847,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1785,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1786,1848,1859,1863,1864,65535,65535,65535,65535,65535},
+    {1787,1849,1860,1864,65535,65535,65535,65535,65535,65535},
+    {1788,1850,1861,65535,65535,65535,65535,65535,65535,65535},
+    {1789,1851,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1790,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1791,1852,1862,65535,65535,65535,65535,65535,65535,65535},
+    {1792,1853,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1793,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1794,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1795,1854,1865,1866,1867,1868,65535,65535,65535,65535},
+    {1796,1855,1866,1869,1870,65535,65535,65535,65535,65535},
+    {1797,1856,1867,1870,65535,65535,65535,65535,65535,65535},
+    {1798,1857,1868,65535,65535,65535,65535,65535,65535,65535},
+    {1799,1858,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1800,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1801,1859,1869,1871,65535,65535,65535,65535,65535,65535},
+    {1802,1860,1870,65535,65535,65535,65535,65535,65535,65535},
+    {1803,1861,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1804,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1805,1862,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1806,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1807,1863,1871,65535,65535,65535,65535,65535,65535,65535},
+    {1808,1864,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1809,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1810,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1811,1865,1872,1873,1874,65535,65535,65535,65535,65535},
+    {1812,1866,1873,1875,65535,65535,65535,65535,65535,65535},
+    {1813,1867,1874,65535,65535,65535,65535,65535,65535,65535},
+    {1814,1868,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1815,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1816,1869,1875,65535,65535,65535,65535,65535,65535,65535},
+    {1817,1870,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1818,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1819,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1820,1871,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1821,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1822,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1823,1872,1876,1877,65535,65535,65535,65535,65535,65535},
+    {1824,1873,1877,65535,65535,65535,65535,65535,65535,65535},
+    {1825,1874,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1826,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1827,1875,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1828,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1829,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1830,1876,1878,65535,65535,65535,65535,65535,65535,65535},
+    {1831,1877,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1832,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1833,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1879,1880,1881,1882,1883,1884,1885,1886,1887,1888},
+    {1880,1889,1890,1891,1892,1893,1894,1895,1896,1897},
+    {1881,1890,1898,1899,1900,1901,1902,1903,1904,1905},
+    {1882,1891,1899,1906,1907,1908,1909,1910,1911,1912},
+    {1883,1892,1900,1907,1913,1914,1915,1916,1917,1918},
+    {1884,1893,1901,1908,1914,1919,1920,1921,1922,65535},
+    {1885,1894,1902,1909,1915,1920,1923,1924,65535,65535},
+    {1886,1895,1903,1910,1916,1921,1924,65535,65535,65535},
+    {1887,1896,1904,1911,1917,1922,65535,65535,65535,65535},
+    {1888,1897,1905,1912,1918,65535,65535,65535,65535,65535},
+    {1889,1925,1926,1927,1928,1929,1930,1931,1932,1933},
+    {1890,1926,1934,1935,1936,1937,1938,1939,1940,1941},
+    {1891,1927,1935,1942,1943,1944,1945,1946,1947,1948},
+    {1892,1928,1936,1943,1949,1950,1951,1952,1953,65535},
+    {1893,1929,1937,1944,1950,1954,1955,1956,65535,65535},
+    {1894,1930,1938,1945,1951,1955,1957,65535,65535,65535},
+    {1895,1931,1939,1946,1952,1956,65535,65535,65535,65535},
+    {1896,1932,1940,1947,1953,65535,65535,65535,65535,65535},
+    {1897,1933,1941,1948,65535,65535,65535,65535,65535,65535},
+    {1898,1934,1958,1959,1960,1961,1962,1963,1964,1965},
+    {1899,1935,1959,1966,1967,1968,1969,1970,1971,65535},
+    {1900,1936,1960,1967,1972,1973,1974,1975,65535,65535},
+    {1901,1937,1961,1968,1973,1976,1977,65535,65535,65535},
+    {1902,1938,1962,1969,1974,1977,65535,65535,65535,65535},
+    {1903,1939,1963,1970,1975,65535,65535,65535,65535,65535},
+    {1904,1940,1964,1971,65535,65535,65535,65535,65535,65535},
+    {1905,1941,1965,65535,65535,65535,65535,65535,65535,65535},
+    {1906,1942,1966,1978,1979,1980,1981,1982,65535,65535},
+    {1907,1943,1967,1979,1983,1984,1985,65535,65535,65535},
+    {1908,1944,1968,1980,1984,1986,65535,65535,65535,65535},
+    {1909,1945,1969,1981,1985,65535,65535,65535,65535,65535},
+    {1910,1946,1970,1982,65535,65535,65535,65535,65535,65535},
+    {1911,1947,1971,65535,65535,65535,65535,65535,65535,65535},
+    {1912,1948,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1913,1949,1972,1983,1987,1988,65535,65535,65535,65535},
+    {1914,1950,1973,1984,1988,65535,65535,65535,65535,65535},
+    {1915,1951,1974,1985,65535,65535,65535,65535,65535,65535},
+    {1916,1952,1975,65535,65535,65535,65535,65535,65535,65535},
+    {1917,1953,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1918,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1919,1954,1976,1986,65535,65535,65535,65535,65535,65535},
+    {1920,1955,1977,65535,65535,65535,65535,65535,65535,65535},
+    {1921,1956,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1922,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1923,1957,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1924,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1925,1989,1990,1991,1992,1993,1994,1995,1996,1997},
+    {1926,1990,1998,1999,2000,2001,2002,2003,2004,2005},
+    {1927,1991,1999,2006,2007,2008,2009,2010,2011,65535},
+    {1928,1992,2000,2007,2012,2013,2014,2015,65535,65535},
+    {1929,1993,2001,2008,2013,2016,2017,65535,65535,65535},
+    {1930,1994,2002,2009,2014,2017,65535,65535,65535,65535},
+    {1931,1995,2003,2010,2015,65535,65535,65535,65535,65535},
+    {1932,1996,2004,2011,65535,65535,65535,65535,65535,65535},
+    {1933,1997,2005,65535,65535,65535,65535,65535,65535,65535},
+    {1934,1998,2018,2019,2020,2021,2022,2023,2024,65535},
+    {1935,1999,2019,2025,2026,2027,2028,2029,65535,65535},
+    {1936,2000,2020,2026,2030,2031,2032,65535,65535,65535},
+    {1937,2001,2021,2027,2031,2033,65535,65535,65535,65535},
+    {1938,2002,2022,2028,2032,65535,65535,65535,65535,65535},
+    {1939,2003,2023,2029,65535,65535,65535,65535,65535,65535},
+    {1940,2004,2024,65535,65535,65535,65535,65535,65535,65535},
+    {1941,2005,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1942,2006,2025,2034,2035,2036,2037,65535,65535,65535},
+    {1943,2007,2026,2035,2038,2039,65535,65535,65535,65535},
+    {1944,2008,2027,2036,2039,65535,65535,65535,65535,65535},
+    {1945,2009,2028,2037,65535,65535,65535,65535,65535,65535},
+    {1946,2010,2029,65535,65535,65535,65535,65535,65535,65535},
+    {1947,2011,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1948,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1949,2012,2030,2038,2040,65535,65535,65535,65535,65535},
+    {1950,2013,2031,2039,65535,65535,65535,65535,65535,65535},
+    {1951,2014,2032,65535,65535,65535,65535,65535,65535,65535},
+    {1952,2015,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1953,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1954,2016,2033,65535,65535,65535,65535,65535,65535,65535},
+    {1955,2017,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1956,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1957,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1958,2018,2041,2042,2043,2044,2045,2046,65535,65535},
+    {1959,2019,2042,2047,2048,2049,2050,65535,65535,65535},
+    {1960,2020,2043,2048,2051,2052,65535,65535,65535,65535},
+    {1961,2021,2044,2049,2052,65535,65535,65535,65535,65535},
+    {1962,2022,2045,2050,65535,65535,65535,65535,65535,65535},
+    {1963,2023,2046,65535,65535,65535,65535,65535,65535,65535},
+    {1964,2024,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1965,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1966,2025,2047,2053,2054,2055,65535,65535,65535,65535},
+    {1967,2026,2048,2054,2056,65535,65535,65535,65535,65535},
+    {1968,2027,2049,2055,65535,65535,65535,65535,65535,65535},
+    {1969,2028,2050,65535,65535,65535,65535,65535,65535,65535},
+    {1970,2029,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1971,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1972,2030,2051,2056,65535,65535,65535,65535,65535,65535},
+    {1973,2031,2052,65535,65535,65535,65535,65535,65535,65535},
+    {1974,2032,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1975,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1976,2033,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1977,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1978,2034,2053,2057,2058,65535,65535,65535,65535,65535},
+    {1979,2035,2054,2058,65535,65535,65535,65535,65535,65535},
+    {1980,2036,2055,65535,65535,65535,65535,65535,65535,65535},
+    {1981,2037,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1982,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1983,2038,2056,65535,65535,65535,65535,65535,65535,65535},
+    {1984,2039,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1985,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1986,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1987,2040,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1988,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1989,2059,2060,2061,2062,2063,2064,2065,2066,2067},
+    {1990,2060,2068,2069,2070,2071,2072,2073,2074,65535},
+    {1991,2061,2069,2075,2076,2077,2078,2079,65535,65535},
+    {1992,2062,2070,2076,2080,2081,2082,65535,65535,65535},
+    {1993,2063,2071,2077,2081,2083,65535,65535,65535,65535},
+    {1994,2064,2072,2078,2082,65535,65535,65535,65535,65535},
+    {1995,2065,2073,2079,65535,65535,65535,65535,65535,65535},
+    {1996,2066,2074,65535,65535,65535,65535,65535,65535,65535},
+    {1997,2067,65535,65535,65535,65535,65535,65535,65535,65535},
+    {1998,2068,2084,2085,2086,2087,2088,2089,65535,65535},
+    {1999,2069,2085,2090,2091,2092,2093,65535,65535,65535},
+    {2000,2070,2086,2091,2094,2095,65535,65535,65535,65535},
+    {2001,2071,2087,2092,2095,65535,65535,65535,65535,65535},
+    {2002,2072,2088,2093,65535,65535,65535,65535,65535,65535},
+    {2003,2073,2089,65535,65535,65535,65535,65535,65535,65535},
+    {2004,2074,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2005,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2006,2075,2090,2096,2097,2098,65535,65535,65535,65535},
+    {2007,2076,2091,2097,2099,65535,65535,65535,65535,65535},
+    {2008,2077,2092,2098,65535,65535,65535,65535,65535,65535},
+    {2009,2078,2093,65535,65535,65535,65535,65535,65535,65535},
+    {2010,2079,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2011,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2012,2080,2094,2099,65535,65535,65535,65535,65535,65535},
+    {2013,2081,2095,65535,65535,65535,65535,65535,65535,65535},
+    {2014,2082,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2015,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2016,2083,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2017,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2018,2084,2100,2101,2102,2103,2104,65535,65535,65535},
+    {2019,2085,2101,2105,2106,2107,65535,65535,65535,65535},
+    {2020,2086,2102,2106,2108,65535,65535,65535,65535,65535},
+    {2021,2087,2103,2107,65535,65535,65535,65535,65535,65535},
+    {2022,2088,2104,65535,65535,65535,65535,65535,65535,65535},
+    {2023,2089,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2024,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2025,2090,2105,2109,2110,65535,65535,65535,65535,65535},
+    {2026,2091,2106,2110,65535,65535,65535,65535,65535,65535},
+    {2027,2092,2107,65535,65535,65535,65535,65535,65535,65535},
+    {2028,2093,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2029,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2030,2094,2108,65535,65535,65535,65535,65535,65535,65535},
+    {2031,2095,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2032,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2033,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2034,2096,2109,2111,65535,65535,65535,65535,65535,65535},
+    {2035,2097,2110,65535,65535,65535,65535,65535,65535,65535},
+    {2036,2098,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2037,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2038,2099,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2039,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2040,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2041,2100,2112,2113,2114,2115,65535,65535,65535,65535},
+    {2042,2101,2113,2116,2117,65535,65535,65535,65535,65535},
+    {2043,2102,2114,2117,65535,65535,65535,65535,65535,65535},
+    {2044,2103,2115,65535,65535,65535,65535,65535,65535,65535},
+    {2045,2104,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2046,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2047,2105,2116,2118,65535,65535,65535,65535,65535,65535},
+    {2048,2106,2117,65535,65535,65535,65535,65535,65535,65535},
+    {2049,2107,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2050,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2051,2108,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2052,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2053,2109,2118,65535,65535,65535,65535,65535,65535,65535},
+    {2054,2110,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2055,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2056,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2057,2111,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2058,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2059,2119,2120,2121,2122,2123,2124,2125,2126,65535},
+    {2060,2120,2127,2128,2129,2130,2131,2132,65535,65535},
+    {2061,2121,2128,2133,2134,2135,2136,65535,65535,65535},
+    {2062,2122,2129,2134,2137,2138,65535,65535,65535,65535},
+    {2063,2123,2130,2135,2138,65535,65535,65535,65535,65535},
+    {2064,2124,2131,2136,65535,65535,65535,65535,65535,65535},
+    {2065,2125,2132,65535,65535,65535,65535,65535,65535,65535},
+    {2066,2126,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2067,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2068,2127,2139,2140,2141,2142,2143,65535,65535,65535},
+    {2069,2128,2140,2144,2145,2146,65535,65535,65535,65535},
+    {2070,2129,2141,2145,2147,65535,65535,65535,65535,65535},
+    {2071,2130,2142,2146,65535,65535,65535,65535,65535,65535},
+    {2072,2131,2143,65535,65535,65535,65535,65535,65535,65535},
+    {2073,2132,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2074,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2075,2133,2144,2148,2149,65535,65535,65535,65535,65535},
+    {2076,2134,2145,2149,65535,65535,65535,65535,65535,65535},
+    {2077,2135,2146,65535,65535,65535,65535,65535,65535,65535},
+    {2078,2136,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2079,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2080,2137,2147,65535,65535,65535,65535,65535,65535,65535},
+    {2081,2138,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2082,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2083,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2084,2139,2150,2151,2152,2153,65535,65535,65535,65535},
+    {2085,2140,2151,2154,2155,65535,65535,65535,65535,65535},
+    {2086,2141,2152,2155,65535,65535,65535,65535,65535,65535},
+    {2087,2142,2153,65535,65535,65535,65535,65535,65535,65535},
+    {2088,2143,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2089,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2090,2144,2154,2156,65535,65535,65535,65535,65535,65535},
+    {2091,2145,2155,65535,65535,65535,65535,65535,65535,65535},
+    {2092,2146,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2093,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2094,2147,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2095,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2096,2148,2156,65535,65535,65535,65535,65535,65535,65535},
+    {2097,2149,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2098,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2099,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2100,2150,2157,2158,2159,65535,65535,65535,65535,65535},
+    {2101,2151,2158,2160,65535,65535,65535,65535,65535,65535},
+    {2102,2152,2159,65535,65535,65535,65535,65535,65535,65535},
+    {2103,2153,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2104,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2105,2154,2160,65535,65535,65535,65535,65535,65535,65535},
+    {2106,2155,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2107,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2108,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2109,2156,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2110,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2111,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2112,2157,2161,2162,65535,65535,65535,65535,65535,65535},
+    {2113,2158,2162,65535,65535,65535,65535,65535,65535,65535},
+    {2114,2159,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2115,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2116,2160,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2117,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2118,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2119,2163,2164,2165,2166,2167,2168,2169,65535,65535},
+    {2120,2164,2170,2171,2172,2173,2174,65535,65535,65535},
+    {2121,2165,2171,2175,2176,2177,65535,65535,65535,65535},
+    {2122,2166,2172,2176,2178,65535,65535,65535,65535,65535},
+    {2123,2167,2173,2177,65535,65535,65535,65535,65535,65535},
+    {2124,2168,2174,65535,65535,65535,65535,65535,65535,65535},
+    {2125,2169,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2126,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2127,2170,2179,2180,2181,2182,65535,65535,65535,65535},
+    {2128,2171,2180,2183,2184,65535,65535,65535,65535,65535},
+    {2129,2172,2181,2184,65535,65535,65535,65535,65535,65535},
+    {2130,2173,2182,65535,65535,65535,65535,65535,65535,65535},
+    {2131,2174,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2132,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2133,2175,2183,2185,65535,65535,65535,65535,65535,65535},
+    {2134,2176,2184,65535,65535,65535,65535,65535,65535,65535},
+    {2135,2177,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2136,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2137,2178,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2138,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2139,2179,2186,2187,2188,65535,65535,65535,65535,65535},
+    {2140,2180,2187,2189,65535,65535,65535,65535,65535,65535},
+    {2141,2181,2188,65535,65535,65535,65535,65535,65535,65535},
+    {2142,2182,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2143,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2144,2183,2189,65535,65535,65535,65535,65535,65535,65535},
+    {2145,2184,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2146,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2147,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2148,2185,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2149,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2150,2186,2190,2191,65535,65535,65535,65535,65535,65535},
+    {2151,2187,2191,65535,65535,65535,65535,65535,65535,65535},
+    {2152,2188,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2153,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2154,2189,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2155,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2156,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2157,2190,2192,65535,65535,65535,65535,65535,65535,65535},
+    {2158,2191,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2159,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2160,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2161,2192,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2162,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2163,2193,2194,2195,2196,2197,2198,65535,65535,65535},
+    {2164,2194,2199,2200,2201,2202,65535,65535,65535,65535},
+    {2165,2195,2200,2203,2204,65535,65535,65535,65535,65535},
+    {2166,2196,2201,2204,65535,65535,65535,65535,65535,65535},
+    {2167,2197,2202,65535,65535,65535,65535,65535,65535,65535},
+    {2168,2198,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2169,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2170,2199,2205,2206,2207,65535,65535,65535,65535,65535},
+    {2171,2200,2206,2208,65535,65535,65535,65535,65535,65535},
+    {2172,2201,2207,65535,65535,65535,65535,65535,65535,65535},
+    {2173,2202,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2174,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2175,2203,2208,65535,65535,65535,65535,65535,65535,65535},
+    {2176,2204,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2177,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2178,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2179,2205,2209,2210,65535,65535,65535,65535,65535,65535},
+    {2180,2206,2210,65535,65535,65535,65535,65535,65535,65535},
+    {2181,2207,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2182,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2183,2208,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2184,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2185,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2186,2209,2211,65535,65535,65535,65535,65535,65535,65535},
+    {2187,2210,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2188,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2189,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2190,2211,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2191,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2192,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2212,2213,2214,2215,2216,2217,2218,2219,2220,2221},
+    {2213,2222,2223,2224,2225,2226,2227,2228,2229,2230},
+    {2214,2223,2231,2232,2233,2234,2235,2236,2237,2238},
+    {2215,2224,2232,2239,2240,2241,2242,2243,2244,2245},
+    {2216,2225,2233,2240,2246,2247,2248,2249,2250,65535},
+    {2217,2226,2234,2241,2247,2251,2252,2253,65535,65535},
+    {2218,2227,2235,2242,2248,2252,2254,65535,65535,65535},
+    {2219,2228,2236,2243,2249,2253,65535,65535,65535,65535},
+    {2220,2229,2237,2244,2250,65535,65535,65535,65535,65535},
+    {2221,2230,2238,2245,65535,65535,65535,65535,65535,65535},
+    {2222,2255,2256,2257,2258,2259,2260,2261,2262,2263},
+    {2223,2256,2264,2265,2266,2267,2268,2269,2270,2271},
+    {2224,2257,2265,2272,2273,2274,2275,2276,2277,65535},
+    {2225,2258,2266,2273,2278,2279,2280,2281,65535,65535},
+    {2226,2259,2267,2274,2279,2282,2283,65535,65535,65535},
+    {2227,2260,2268,2275,2280,2283,65535,65535,65535,65535},
+    {2228,2261,2269,2276,2281,65535,65535,65535,65535,65535},
+    {2229,2262,2270,2277,65535,65535,65535,65535,65535,65535},
+    {2230,2263,2271,65535,65535,65535,65535,65535,65535,65535},
+    {2231,2264,2284,2285,2286,2287,2288,2289,2290,65535},
+    {2232,2265,2285,2291,2292,2293,2294,2295,65535,65535},
+    {2233,2266,2286,2292,2296,2297,2298,65535,65535,65535},
+    {2234,2267,2287,2293,2297,2299,65535,65535,65535,65535},
+    {2235,2268,2288,2294,2298,65535,65535,65535,65535,65535},
+    {2236,2269,2289,2295,65535,65535,65535,65535,65535,65535},
+    {2237,2270,2290,65535,65535,65535,65535,65535,65535,65535},
+    {2238,2271,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2239,2272,2291,2300,2301,2302,2303,65535,65535,65535},
+    {2240,2273,2292,2301,2304,2305,65535,65535,65535,65535},
+    {2241,2274,2293,2302,2305,65535,65535,65535,65535,65535},
+    {2242,2275,2294,2303,65535,65535,65535,65535,65535,65535},
+    {2243,2276,2295,65535,65535,65535,65535,65535,65535,65535},
+    {2244,2277,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2245,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2246,2278,2296,2304,2306,65535,65535,65535,65535,65535},
+    {2247,2279,2297,2305,65535,65535,65535,65535,65535,65535},
+    {2248,2280,2298,65535,65535,65535,65535,65535,65535,65535},
+    {2249,2281,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2250,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2251,2282,2299,65535,65535,65535,65535,65535,65535,65535},
+    {2252,2283,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2253,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2254,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2255,2307,2308,2309,2310,2311,2312,2313,2314,2315},
+    {2256,2308,2316,2317,2318,2319,2320,2321,2322,65535},
+    {2257,2309,2317,2323,2324,2325,2326,2327,65535,65535},
+    {2258,2310,2318,2324,2328,2329,2330,65535,65535,65535},
+    {2259,2311,2319,2325,2329,2331,65535,65535,65535,65535},
+    {2260,2312,2320,2326,2330,65535,65535,65535,65535,65535},
+    {2261,2313,2321,2327,65535,65535,65535,65535,65535,65535},
+    {2262,2314,2322,65535,65535,65535,65535,65535,65535,65535},
+    {2263,2315,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2264,2316,2332,2333,2334,2335,2336,2337,65535,65535},
+    {2265,2317,2333,2338,2339,2340,2341,65535,65535,65535},
+    {2266,2318,2334,2339,2342,2343,65535,65535,65535,65535},
+    {2267,2319,2335,2340,2343,65535,65535,65535,65535,65535},
+    {2268,2320,2336,2341,65535,65535,65535,65535,65535,65535},
+    {2269,2321,2337,65535,65535,65535,65535,65535,65535,65535},
+    {2270,2322,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2271,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2272,2323,2338,2344,2345,2346,65535,65535,65535,65535},
+    {2273,2324,2339,2345,2347,65535,65535,65535,65535,65535},
+    {2274,2325,2340,2346,65535,65535,65535,65535,65535,65535},
+    {2275,2326,2341,65535,65535,65535,65535,65535,65535,65535},
+    {2276,2327,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2277,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2278,2328,2342,2347,65535,65535,65535,65535,65535,65535},
+    {2279,2329,2343,65535,65535,65535,65535,65535,65535,65535},
+    {2280,2330,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2281,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2282,2331,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2283,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2284,2332,2348,2349,2350,2351,2352,65535,65535,65535},
+    {2285,2333,2349,2353,2354,2355,65535,65535,65535,65535},
+    {2286,2334,2350,2354,2356,65535,65535,65535,65535,65535},
+    {2287,2335,2351,2355,65535,65535,65535,65535,65535,65535},
+    {2288,2336,2352,65535,65535,65535,65535,65535,65535,65535},
+    {2289,2337,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2290,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2291,2338,2353,2357,2358,65535,65535,65535,65535,65535},
+    {2292,2339,2354,2358,65535,65535,65535,65535,65535,65535},
+    {2293,2340,2355,65535,65535,65535,65535,65535,65535,65535},
+    {2294,2341,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2295,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2296,2342,2356,65535,65535,65535,65535,65535,65535,65535},
+    {2297,2343,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2298,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2299,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2300,2344,2357,2359,65535,65535,65535,65535,65535,65535},
+    {2301,2345,2358,65535,65535,65535,65535,65535,65535,65535},
+    {2302,2346,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2303,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2304,2347,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2305,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2306,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2307,2360,2361,2362,2363,2364,2365,2366,2367,65535},
+    {2308,2361,2368,2369,2370,2371,2372,2373,65535,65535},
+    {2309,2362,2369,2374,2375,2376,2377,65535,65535,65535},
+    {2310,2363,2370,2375,2378,2379,65535,65535,65535,65535},
+    {2311,2364,2371,2376,2379,65535,65535,65535,65535,65535},
+    {2312,2365,2372,2377,65535,65535,65535,65535,65535,65535},
+    {2313,2366,2373,65535,65535,65535,65535,65535,65535,65535},
+    {2314,2367,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2315,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2316,2368,2380,2381,2382,2383,2384,65535,65535,65535},
+    {2317,2369,2381,2385,2386,2387,65535,65535,65535,65535},
+    {2318,2370,2382,2386,2388,65535,65535,65535,65535,65535},
+    {2319,2371,2383,2387,65535,65535,65535,65535,65535,65535},
+    {2320,2372,2384,65535,65535,65535,65535,65535,65535,65535},
+    {2321,2373,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2322,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2323,2374,2385,2389,2390,65535,65535,65535,65535,65535},
+    {2324,2375,2386,2390,65535,65535,65535,65535,65535,65535},
+    {2325,2376,2387,65535,65535,65535,65535,65535,65535,65535},
+    {2326,2377,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2327,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2328,2378,2388,65535,65535,65535,65535,65535,65535,65535},
+    {2329,2379,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2330,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2331,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2332,2380,2391,2392,2393,2394,65535,65535,65535,65535},
+    {2333,2381,2392,2395,2396,65535,65535,65535,65535,65535},
+    {2334,2382,2393,2396,65535,65535,65535,65535,65535,65535},
+    {2335,2383,2394,65535,65535,65535,65535,65535,65535,65535},
+    {2336,2384,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2337,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2338,2385,2395,2397,65535,65535,65535,65535,65535,65535},
+    {2339,2386,2396,65535,65535,65535,65535,65535,65535,65535},
+    {2340,2387,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2341,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2342,2388,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2343,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2344,2389,2397,65535,65535,65535,65535,65535,65535,65535},
+    {2345,2390,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2346,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2347,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2348,2391,2398,2399,2400,65535,65535,65535,65535,65535},
+    {2349,2392,2399,2401,65535,65535,65535,65535,65535,65535},
+    {2350,2393,2400,65535,65535,65535,65535,65535,65535,65535},
+    {2351,2394,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2352,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2353,2395,2401,65535,65535,65535,65535,65535,65535,65535},
+    {2354,2396,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2355,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2356,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2357,2397,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2358,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2359,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2360,2402,2403,2404,2405,2406,2407,2408,65535,65535},
+    {2361,2403,2409,2410,2411,2412,2413,65535,65535,65535},
+    {2362,2404,2410,2414,2415,2416,65535,65535,65535,65535},
+    {2363,2405,2411,2415,2417,65535,65535,65535,65535,65535},
+    {2364,2406,2412,2416,65535,65535,65535,65535,65535,65535},
+    {2365,2407,2413,65535,65535,65535,65535,65535,65535,65535},
+    {2366,2408,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2367,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2368,2409,2418,2419,2420,2421,65535,65535,65535,65535},
+    {2369,2410,2419,2422,2423,65535,65535,65535,65535,65535},
+    {2370,2411,2420,2423,65535,65535,65535,65535,65535,65535},
+    {2371,2412,2421,65535,65535,65535,65535,65535,65535,65535},
+    {2372,2413,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2373,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2374,2414,2422,2424,65535,65535,65535,65535,65535,65535},
+    {2375,2415,2423,65535,65535,65535,65535,65535,65535,65535},
+    {2376,2416,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2377,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2378,2417,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2379,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2380,2418,2425,2426,2427,65535,65535,65535,65535,65535},
+    {2381,2419,2426,2428,65535,65535,65535,65535,65535,65535},
+    {2382,2420,2427,65535,65535,65535,65535,65535,65535,65535},
+    {2383,2421,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2384,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2385,2422,2428,65535,65535,65535,65535,65535,65535,65535},
+    {2386,2423,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2387,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2388,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2389,2424,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2390,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2391,2425,2429,2430,65535,65535,65535,65535,65535,65535},
+    {2392,2426,2430,65535,65535,65535,65535,65535,65535,65535},
+    {2393,2427,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2394,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2395,2428,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2396,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2397,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2398,2429,2431,65535,65535,65535,65535,65535,65535,65535},
+    {2399,2430,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2400,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2401,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2402,2432,2433,2434,2435,2436,2437,65535,65535,65535},
+    {2403,2433,2438,2439,2440,2441,65535,65535,65535,65535},
+    {2404,2434,2439,2442,2443,65535,65535,65535,65535,65535},
+    {2405,2435,2440,2443,65535,65535,65535,65535,65535,65535},
+    {2406,2436,2441,65535,65535,65535,65535,65535,65535,65535},
+    {2407,2437,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2408,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2409,2438,2444,2445,2446,65535,65535,65535,65535,65535},
+    {2410,2439,2445,2447,65535,65535,65535,65535,65535,65535},
+    {2411,2440,2446,65535,65535,65535,65535,65535,65535,65535},
+    {2412,2441,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2413,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2414,2442,2447,65535,65535,65535,65535,65535,65535,65535},
+    {2415,2443,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2416,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2417,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2418,2444,2448,2449,65535,65535,65535,65535,65535,65535},
+    {2419,2445,2449,65535,65535,65535,65535,65535,65535,65535},
+    {2420,2446,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2421,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2422,2447,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2423,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2424,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2425,2448,2450,65535,65535,65535,65535,65535,65535,65535},
+    {2426,2449,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2427,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2428,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2429,2450,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2430,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2431,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2432,2451,2452,2453,2454,2455,65535,65535,65535,65535},
+    {2433,2452,2456,2457,2458,65535,65535,65535,65535,65535},
+    {2434,2453,2457,2459,65535,65535,65535,65535,65535,65535},
+    {2435,2454,2458,65535,65535,65535,65535,65535,65535,65535},
+    {2436,2455,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2437,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2438,2456,2460,2461,65535,65535,65535,65535,65535,65535},
+    {2439,2457,2461,65535,65535,65535,65535,65535,65535,65535},
+    {2440,2458,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2441,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2442,2459,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2443,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2444,2460,2462,65535,65535,65535,65535,65535,65535,65535},
+    {2445,2461,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2446,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2447,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2448,2462,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2449,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2450,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2451,2463,2464,2465,2466,65535,65535,65535,65535,65535},
+    {2452,2464,2467,2468,65535,65535,65535,65535,65535,65535},
+    {2453,2465,2468,65535,65535,65535,65535,65535,65535,65535},
+    {2454,2466,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2455,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2456,2467,2469,65535,65535,65535,65535,65535,65535,65535},
+    {2457,2468,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2458,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2459,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2460,2469,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2461,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2462,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2470,2471,2472,2473,2474,2475,2476,2477,2478,2479},
+    {2471,2480,2481,2482,2483,2484,2485,2486,2487,2488},
+    {2472,2481,2489,2490,2491,2492,2493,2494,2495,2496},
+    {2473,2482,2490,2497,2498,2499,2500,2501,2502,65535},
+    {2474,2483,2491,2498,2503,2504,2505,2506,65535,65535},
+    {2475,2484,2492,2499,2504,2507,2508,65535,65535,65535},
+    {2476,2485,2493,2500,2505,2508,65535,65535,65535,65535},
+    {2477,2486,2494,2501,2506,65535,65535,65535,65535,65535},
+    {2478,2487,2495,2502,65535,65535,65535,65535,65535,65535},
+    {2479,2488,2496,65535,65535,65535,65535,65535,65535,65535},
+    {2480,2509,2510,2511,2512,2513,2514,2515,2516,2517},
+    {2481,2510,2518,2519,2520,2521,2522,2523,2524,65535},
+    {2482,2511,2519,2525,2526,2527,2528,2529,65535,65535},
+    {2483,2512,2520,2526,2530,2531,2532,65535,65535,65535},
+    {2484,2513,2521,2527,2531,2533,65535,65535,65535,65535},
+    {2485,2514,2522,2528,2532,65535,65535,65535,65535,65535},
+    {2486,2515,2523,2529,65535,65535,65535,65535,65535,65535},
+    {2487,2516,2524,65535,65535,65535,65535,65535,65535,65535},
+    {2488,2517,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2489,2518,2534,2535,2536,2537,2538,2539,65535,65535},
+    {2490,2519,2535,2540,2541,2542,2543,65535,65535,65535},
+    {2491,2520,2536,2541,2544,2545,65535,65535,65535,65535},
+    {2492,2521,2537,2542,2545,65535,65535,65535,65535,65535},
+    {2493,2522,2538,2543,65535,65535,65535,65535,65535,65535},
+    {2494,2523,2539,65535,65535,65535,65535,65535,65535,65535},
+    {2495,2524,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2496,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2497,2525,2540,2546,2547,2548,65535,65535,65535,65535},
+    {2498,2526,2541,2547,2549,65535,65535,65535,65535,65535},
+    {2499,2527,2542,2548,65535,65535,65535,65535,65535,65535},
+    {2500,2528,2543,65535,65535,65535,65535,65535,65535,65535},
+    {2501,2529,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2502,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2503,2530,2544,2549,65535,65535,65535,65535,65535,65535},
+    {2504,2531,2545,65535,65535,65535,65535,65535,65535,65535},
+    {2505,2532,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2506,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2507,2533,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2508,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2509,2550,2551,2552,2553,2554,2555,2556,2557,65535},
+    {2510,2551,2558,2559,2560,2561,2562,2563,65535,65535},
+    {2511,2552,2559,2564,2565,2566,2567,65535,65535,65535},
+    {2512,2553,2560,2565,2568,2569,65535,65535,65535,65535},
+    {2513,2554,2561,2566,2569,65535,65535,65535,65535,65535},
+    {2514,2555,2562,2567,65535,65535,65535,65535,65535,65535},
+    {2515,2556,2563,65535,65535,65535,65535,65535,65535,65535},
+    {2516,2557,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2517,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2518,2558,2570,2571,2572,2573,2574,65535,65535,65535},
+    {2519,2559,2571,2575,2576,2577,65535,65535,65535,65535},
+    {2520,2560,2572,2576,2578,65535,65535,65535,65535,65535},
+    {2521,2561,2573,2577,65535,65535,65535,65535,65535,65535},
+    {2522,2562,2574,65535,65535,65535,65535,65535,65535,65535},
+    {2523,2563,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2524,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2525,2564,2575,2579,2580,65535,65535,65535,65535,65535},
+    {2526,2565,2576,2580,65535,65535,65535,65535,65535,65535},
+    {2527,2566,2577,65535,65535,65535,65535,65535,65535,65535},
+    {2528,2567,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2529,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2530,2568,2578,65535,65535,65535,65535,65535,65535,65535},
+    {2531,2569,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2532,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2533,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2534,2570,2581,2582,2583,2584,65535,65535,65535,65535},
+    {2535,2571,2582,2585,2586,65535,65535,65535,65535,65535},
+    {2536,2572,2583,2586,65535,65535,65535,65535,65535,65535},
+    {2537,2573,2584,65535,65535,65535,65535,65535,65535,65535},
+    {2538,2574,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2539,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2540,2575,2585,2587,65535,65535,65535,65535,65535,65535},
+    {2541,2576,2586,65535,65535,65535,65535,65535,65535,65535},
+    {2542,2577,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2543,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2544,2578,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2545,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2546,2579,2587,65535,65535,65535,65535,65535,65535,65535},
+    {2547,2580,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2548,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2549,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2550,2588,2589,2590,2591,2592,2593,2594,65535,65535},
+    {2551,2589,2595,2596,2597,2598,2599,65535,65535,65535},
+    {2552,2590,2596,2600,2601,2602,65535,65535,65535,65535},
+    {2553,2591,2597,2601,2603,65535,65535,65535,65535,65535},
+    {2554,2592,2598,2602,65535,65535,65535,65535,65535,65535},
+    {2555,2593,2599,65535,65535,65535,65535,65535,65535,65535},
+    {2556,2594,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2557,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2558,2595,2604,2605,2606,2607,65535,65535,65535,65535},
+    {2559,2596,2605,2608,2609,65535,65535,65535,65535,65535},
+    {2560,2597,2606,2609,65535,65535,65535,65535,65535,65535},
+    {2561,2598,2607,65535,65535,65535,65535,65535,65535,65535},
+    {2562,2599,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2563,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2564,2600,2608,2610,65535,65535,65535,65535,65535,65535},
+    {2565,2601,2609,65535,65535,65535,65535,65535,65535,65535},
+    {2566,2602,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2567,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2568,2603,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2569,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2570,2604,2611,2612,2613,65535,65535,65535,65535,65535},
+    {2571,2605,2612,2614,65535,65535,65535,65535,65535,65535},
+    {2572,2606,2613,65535,65535,65535,65535,65535,65535,65535},
+    {2573,2607,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2574,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2575,2608,2614,65535,65535,65535,65535,65535,65535,65535},
+    {2576,2609,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2577,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2578,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2579,2610,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2580,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2581,2611,2615,2616,65535,65535,65535,65535,65535,65535},
+    {2582,2612,2616,65535,65535,65535,65535,65535,65535,65535},
+    {2583,2613,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2584,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2585,2614,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2586,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2587,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2588,2617,2618,2619,2620,2621,2622,65535,65535,65535},
+    {2589,2618,2623,2624,2625,2626,65535,65535,65535,65535},
+    {2590,2619,2624,2627,2628,65535,65535,65535,65535,65535},
+    {2591,2620,2625,2628,65535,65535,65535,65535,65535,65535},
+    {2592,2621,2626,65535,65535,65535,65535,65535,65535,65535},
+    {2593,2622,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2594,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2595,2623,2629,2630,2631,65535,65535,65535,65535,65535},
+    {2596,2624,2630,2632,65535,65535,65535,65535,65535,65535},
+    {2597,2625,2631,65535,65535,65535,65535,65535,65535,65535},
+    {2598,2626,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2599,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2600,2627,2632,65535,65535,65535,65535,65535,65535,65535},
+    {2601,2628,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2602,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2603,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2604,2629,2633,2634,65535,65535,65535,65535,65535,65535},
+    {2605,2630,2634,65535,65535,65535,65535,65535,65535,65535},
+    {2606,2631,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2607,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2608,2632,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2609,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2610,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2611,2633,2635,65535,65535,65535,65535,65535,65535,65535},
+    {2612,2634,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2613,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2614,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2615,2635,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2616,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2617,2636,2637,2638,2639,2640,65535,65535,65535,65535},
+    {2618,2637,2641,2642,2643,65535,65535,65535,65535,65535},
+    {2619,2638,2642,2644,65535,65535,65535,65535,65535,65535},
+    {2620,2639,2643,65535,65535,65535,65535,65535,65535,65535},
+    {2621,2640,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2622,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2623,2641,2645,2646,65535,65535,65535,65535,65535,65535},
+    {2624,2642,2646,65535,65535,65535,65535,65535,65535,65535},
+    {2625,2643,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2626,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2627,2644,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2628,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2629,2645,2647,65535,65535,65535,65535,65535,65535,65535},
+    {2630,2646,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2631,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2632,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2633,2647,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2634,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2635,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2636,2648,2649,2650,2651,65535,65535,65535,65535,65535},
+    {2637,2649,2652,2653,65535,65535,65535,65535,65535,65535},
+    {2638,2650,2653,65535,65535,65535,65535,65535,65535,65535},
+    {2639,2651,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2640,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2641,2652,2654,65535,65535,65535,65535,65535,65535,65535},
+    {2642,2653,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2643,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2644,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2645,2654,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2646,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2647,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2648,2655,2656,2657,65535,65535,65535,65535,65535,65535},
+    {2649,2656,2658,65535,65535,65535,65535,65535,65535,65535},
+    {2650,2657,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2651,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2652,2658,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2653,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2654,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2655,2659,2660,65535,65535,65535,65535,65535,65535,65535},
+    {2656,2660,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2657,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2658,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2661,2662,2663,2664,2665,2666,2667,2668,2669,2670},
+    {2662,2671,2672,2673,2674,2675,2676,2677,2678,2679},
+    {2663,2672,2680,2681,2682,2683,2684,2685,2686,65535},
+    {2664,2673,2681,2687,2688,2689,2690,2691,65535,65535},
+    {2665,2674,2682,2688,2692,2693,2694,65535,65535,65535},
+    {2666,2675,2683,2689,2693,2695,65535,65535,65535,65535},
+    {2667,2676,2684,2690,2694,65535,65535,65535,65535,65535},
+    {2668,2677,2685,2691,65535,65535,65535,65535,65535,65535},
+    {2669,2678,2686,65535,65535,65535,65535,65535,65535,65535},
+    {2670,2679,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2671,2696,2697,2698,2699,2700,2701,2702,2703,65535},
+    {2672,2697,2704,2705,2706,2707,2708,2709,65535,65535},
+    {2673,2698,2705,2710,2711,2712,2713,65535,65535,65535},
+    {2674,2699,2706,2711,2714,2715,65535,65535,65535,65535},
+    {2675,2700,2707,2712,2715,65535,65535,65535,65535,65535},
+    {2676,2701,2708,2713,65535,65535,65535,65535,65535,65535},
+    {2677,2702,2709,65535,65535,65535,65535,65535,65535,65535},
+    {2678,2703,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2679,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2680,2704,2716,2717,2718,2719,2720,65535,65535,65535},
+    {2681,2705,2717,2721,2722,2723,65535,65535,65535,65535},
+    {2682,2706,2718,2722,2724,65535,65535,65535,65535,65535},
+    {2683,2707,2719,2723,65535,65535,65535,65535,65535,65535},
+    {2684,2708,2720,65535,65535,65535,65535,65535,65535,65535},
+    {2685,2709,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2686,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2687,2710,2721,2725,2726,65535,65535,65535,65535,65535},
+    {2688,2711,2722,2726,65535,65535,65535,65535,65535,65535},
+    {2689,2712,2723,65535,65535,65535,65535,65535,65535,65535},
+    {2690,2713,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2691,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2692,2714,2724,65535,65535,65535,65535,65535,65535,65535},
+    {2693,2715,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2694,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2695,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2696,2727,2728,2729,2730,2731,2732,2733,65535,65535},
+    {2697,2728,2734,2735,2736,2737,2738,65535,65535,65535},
+    {2698,2729,2735,2739,2740,2741,65535,65535,65535,65535},
+    {2699,2730,2736,2740,2742,65535,65535,65535,65535,65535},
+    {2700,2731,2737,2741,65535,65535,65535,65535,65535,65535},
+    {2701,2732,2738,65535,65535,65535,65535,65535,65535,65535},
+    {2702,2733,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2703,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2704,2734,2743,2744,2745,2746,65535,65535,65535,65535},
+    {2705,2735,2744,2747,2748,65535,65535,65535,65535,65535},
+    {2706,2736,2745,2748,65535,65535,65535,65535,65535,65535},
+    {2707,2737,2746,65535,65535,65535,65535,65535,65535,65535},
+    {2708,2738,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2709,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2710,2739,2747,2749,65535,65535,65535,65535,65535,65535},
+    {2711,2740,2748,65535,65535,65535,65535,65535,65535,65535},
+    {2712,2741,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2713,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2714,2742,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2715,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2716,2743,2750,2751,2752,65535,65535,65535,65535,65535},
+    {2717,2744,2751,2753,65535,65535,65535,65535,65535,65535},
+    {2718,2745,2752,65535,65535,65535,65535,65535,65535,65535},
+    {2719,2746,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2720,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2721,2747,2753,65535,65535,65535,65535,65535,65535,65535},
+    {2722,2748,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2723,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2724,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2725,2749,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2726,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2727,2754,2755,2756,2757,2758,2759,65535,65535,65535},
+    {2728,2755,2760,2761,2762,2763,65535,65535,65535,65535},
+    {2729,2756,2761,2764,2765,65535,65535,65535,65535,65535},
+    {2730,2757,2762,2765,65535,65535,65535,65535,65535,65535},
+    {2731,2758,2763,65535,65535,65535,65535,65535,65535,65535},
+    {2732,2759,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2733,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2734,2760,2766,2767,2768,65535,65535,65535,65535,65535},
+    {2735,2761,2767,2769,65535,65535,65535,65535,65535,65535},
+    {2736,2762,2768,65535,65535,65535,65535,65535,65535,65535},
+    {2737,2763,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2738,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2739,2764,2769,65535,65535,65535,65535,65535,65535,65535},
+    {2740,2765,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2741,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2742,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2743,2766,2770,2771,65535,65535,65535,65535,65535,65535},
+    {2744,2767,2771,65535,65535,65535,65535,65535,65535,65535},
+    {2745,2768,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2746,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2747,2769,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2748,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2749,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2750,2770,2772,65535,65535,65535,65535,65535,65535,65535},
+    {2751,2771,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2752,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2753,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2754,2773,2774,2775,2776,2777,65535,65535,65535,65535},
+    {2755,2774,2778,2779,2780,65535,65535,65535,65535,65535},
+    {2756,2775,2779,2781,65535,65535,65535,65535,65535,65535},
+    {2757,2776,2780,65535,65535,65535,65535,65535,65535,65535},
+    {2758,2777,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2759,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2760,2778,2782,2783,65535,65535,65535,65535,65535,65535},
+    {2761,2779,2783,65535,65535,65535,65535,65535,65535,65535},
+    {2762,2780,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2763,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2764,2781,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2765,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2766,2782,2784,65535,65535,65535,65535,65535,65535,65535},
+    {2767,2783,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2768,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2769,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2770,2784,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2771,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2772,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2773,2785,2786,2787,2788,65535,65535,65535,65535,65535},
+    {2774,2786,2789,2790,65535,65535,65535,65535,65535,65535},
+    {2775,2787,2790,65535,65535,65535,65535,65535,65535,65535},
+    {2776,2788,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2777,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2778,2789,2791,65535,65535,65535,65535,65535,65535,65535},
+    {2779,2790,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2780,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2781,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2782,2791,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2783,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2784,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2785,2792,2793,2794,65535,65535,65535,65535,65535,65535},
+    {2786,2793,2795,65535,65535,65535,65535,65535,65535,65535},
+    {2787,2794,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2788,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2789,2795,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2790,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2791,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2792,2796,2797,65535,65535,65535,65535,65535,65535,65535},
+    {2793,2797,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2794,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2795,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2796,2798,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2797,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2798,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2799,2800,2801,2802,2803,2804,2805,2806,2807,2808},
+    {2800,2809,2810,2811,2812,2813,2814,2815,2816,65535},
+    {2801,2810,2817,2818,2819,2820,2821,2822,65535,65535},
+    {2802,2811,2818,2823,2824,2825,2826,65535,65535,65535},
+    {2803,2812,2819,2824,2827,2828,65535,65535,65535,65535},
+    {2804,2813,2820,2825,2828,65535,65535,65535,65535,65535},
+    {2805,2814,2821,2826,65535,65535,65535,65535,65535,65535},
+    {2806,2815,2822,65535,65535,65535,65535,65535,65535,65535},
+    {2807,2816,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2808,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2809,2829,2830,2831,2832,2833,2834,2835,65535,65535},
+    {2810,2830,2836,2837,2838,2839,2840,65535,65535,65535},
+    {2811,2831,2837,2841,2842,2843,65535,65535,65535,65535},
+    {2812,2832,2838,2842,2844,65535,65535,65535,65535,65535},
+    {2813,2833,2839,2843,65535,65535,65535,65535,65535,65535},
+    {2814,2834,2840,65535,65535,65535,65535,65535,65535,65535},
+    {2815,2835,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2816,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2817,2836,2845,2846,2847,2848,65535,65535,65535,65535},
+    {2818,2837,2846,2849,2850,65535,65535,65535,65535,65535},
+    {2819,2838,2847,2850,65535,65535,65535,65535,65535,65535},
+    {2820,2839,2848,65535,65535,65535,65535,65535,65535,65535},
+    {2821,2840,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2822,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2823,2841,2849,2851,65535,65535,65535,65535,65535,65535},
+    {2824,2842,2850,65535,65535,65535,65535,65535,65535,65535},
+    {2825,2843,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2826,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2827,2844,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2828,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2829,2852,2853,2854,2855,2856,2857,65535,65535,65535},
+    {2830,2853,2858,2859,2860,2861,65535,65535,65535,65535},
+    {2831,2854,2859,2862,2863,65535,65535,65535,65535,65535},
+    {2832,2855,2860,2863,65535,65535,65535,65535,65535,65535},
+    {2833,2856,2861,65535,65535,65535,65535,65535,65535,65535},
+    {2834,2857,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2835,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2836,2858,2864,2865,2866,65535,65535,65535,65535,65535},
+    {2837,2859,2865,2867,65535,65535,65535,65535,65535,65535},
+    {2838,2860,2866,65535,65535,65535,65535,65535,65535,65535},
+    {2839,2861,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2840,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2841,2862,2867,65535,65535,65535,65535,65535,65535,65535},
+    {2842,2863,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2843,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2844,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2845,2864,2868,2869,65535,65535,65535,65535,65535,65535},
+    {2846,2865,2869,65535,65535,65535,65535,65535,65535,65535},
+    {2847,2866,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2848,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2849,2867,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2850,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2851,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2852,2870,2871,2872,2873,2874,65535,65535,65535,65535},
+    {2853,2871,2875,2876,2877,65535,65535,65535,65535,65535},
+    {2854,2872,2876,2878,65535,65535,65535,65535,65535,65535},
+    {2855,2873,2877,65535,65535,65535,65535,65535,65535,65535},
+    {2856,2874,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2857,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2858,2875,2879,2880,65535,65535,65535,65535,65535,65535},
+    {2859,2876,2880,65535,65535,65535,65535,65535,65535,65535},
+    {2860,2877,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2861,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2862,2878,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2863,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2864,2879,2881,65535,65535,65535,65535,65535,65535,65535},
+    {2865,2880,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2866,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2867,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2868,2881,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2869,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2870,2882,2883,2884,2885,65535,65535,65535,65535,65535},
+    {2871,2883,2886,2887,65535,65535,65535,65535,65535,65535},
+    {2872,2884,2887,65535,65535,65535,65535,65535,65535,65535},
+    {2873,2885,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2874,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2875,2886,2888,65535,65535,65535,65535,65535,65535,65535},
+    {2876,2887,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2877,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2878,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2879,2888,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2880,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2881,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2882,2889,2890,2891,65535,65535,65535,65535,65535,65535},
+    {2883,2890,2892,65535,65535,65535,65535,65535,65535,65535},
+    {2884,2891,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2885,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2886,2892,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2887,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2888,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2889,2893,2894,65535,65535,65535,65535,65535,65535,65535},
+    {2890,2894,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2891,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2892,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2893,2895,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2894,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2895,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2896,2897,2898,2899,2900,2901,2902,2903,2904,65535},
+    {2897,2905,2906,2907,2908,2909,2910,2911,65535,65535},
+    {2898,2906,2912,2913,2914,2915,2916,65535,65535,65535},
+    {2899,2907,2913,2917,2918,2919,65535,65535,65535,65535},
+    {2900,2908,2914,2918,2920,65535,65535,65535,65535,65535},
+    {2901,2909,2915,2919,65535,65535,65535,65535,65535,65535},
+    {2902,2910,2916,65535,65535,65535,65535,65535,65535,65535},
+    {2903,2911,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2904,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2905,2921,2922,2923,2924,2925,2926,65535,65535,65535},
+    {2906,2922,2927,2928,2929,2930,65535,65535,65535,65535},
+    {2907,2923,2928,2931,2932,65535,65535,65535,65535,65535},
+    {2908,2924,2929,2932,65535,65535,65535,65535,65535,65535},
+    {2909,2925,2930,65535,65535,65535,65535,65535,65535,65535},
+    {2910,2926,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2911,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2912,2927,2933,2934,2935,65535,65535,65535,65535,65535},
+    {2913,2928,2934,2936,65535,65535,65535,65535,65535,65535},
+    {2914,2929,2935,65535,65535,65535,65535,65535,65535,65535},
+    {2915,2930,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2916,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2917,2931,2936,65535,65535,65535,65535,65535,65535,65535},
+    {2918,2932,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2919,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2920,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2921,2937,2938,2939,2940,2941,65535,65535,65535,65535},
+    {2922,2938,2942,2943,2944,65535,65535,65535,65535,65535},
+    {2923,2939,2943,2945,65535,65535,65535,65535,65535,65535},
+    {2924,2940,2944,65535,65535,65535,65535,65535,65535,65535},
+    {2925,2941,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2926,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2927,2942,2946,2947,65535,65535,65535,65535,65535,65535},
+    {2928,2943,2947,65535,65535,65535,65535,65535,65535,65535},
+    {2929,2944,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2930,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2931,2945,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2932,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2933,2946,2948,65535,65535,65535,65535,65535,65535,65535},
+    {2934,2947,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2935,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2936,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2937,2949,2950,2951,2952,65535,65535,65535,65535,65535},
+    {2938,2950,2953,2954,65535,65535,65535,65535,65535,65535},
+    {2939,2951,2954,65535,65535,65535,65535,65535,65535,65535},
+    {2940,2952,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2941,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2942,2953,2955,65535,65535,65535,65535,65535,65535,65535},
+    {2943,2954,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2944,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2945,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2946,2955,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2947,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2948,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2949,2956,2957,2958,65535,65535,65535,65535,65535,65535},
+    {2950,2957,2959,65535,65535,65535,65535,65535,65535,65535},
+    {2951,2958,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2952,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2953,2959,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2954,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2955,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2956,2960,2961,65535,65535,65535,65535,65535,65535,65535},
+    {2957,2961,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2958,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2959,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2960,2962,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2961,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2962,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2963,2964,2965,2966,2967,2968,2969,2970,65535,65535},
+    {2964,2971,2972,2973,2974,2975,2976,65535,65535,65535},
+    {2965,2972,2977,2978,2979,2980,65535,65535,65535,65535},
+    {2966,2973,2978,2981,2982,65535,65535,65535,65535,65535},
+    {2967,2974,2979,2982,65535,65535,65535,65535,65535,65535},
+    {2968,2975,2980,65535,65535,65535,65535,65535,65535,65535},
+    {2969,2976,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2970,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2971,2983,2984,2985,2986,2987,65535,65535,65535,65535},
+    {2972,2984,2988,2989,2990,65535,65535,65535,65535,65535},
+    {2973,2985,2989,2991,65535,65535,65535,65535,65535,65535},
+    {2974,2986,2990,65535,65535,65535,65535,65535,65535,65535},
+    {2975,2987,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2976,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2977,2988,2992,2993,65535,65535,65535,65535,65535,65535},
+    {2978,2989,2993,65535,65535,65535,65535,65535,65535,65535},
+    {2979,2990,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2980,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2981,2991,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2982,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2983,2994,2995,2996,2997,65535,65535,65535,65535,65535},
+    {2984,2995,2998,2999,65535,65535,65535,65535,65535,65535},
+    {2985,2996,2999,65535,65535,65535,65535,65535,65535,65535},
+    {2986,2997,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2987,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2988,2998,3000,65535,65535,65535,65535,65535,65535,65535},
+    {2989,2999,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2990,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2991,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2992,3000,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2993,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2994,3001,3002,3003,65535,65535,65535,65535,65535,65535},
+    {2995,3002,3004,65535,65535,65535,65535,65535,65535,65535},
+    {2996,3003,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2997,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2998,3004,65535,65535,65535,65535,65535,65535,65535,65535},
+    {2999,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3000,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3001,3005,3006,65535,65535,65535,65535,65535,65535,65535},
+    {3002,3006,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3003,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3004,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3005,3007,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3006,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3007,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3008,3009,3010,3011,3012,3013,3014,65535,65535,65535},
+    {3009,3015,3016,3017,3018,3019,65535,65535,65535,65535},
+    {3010,3016,3020,3021,3022,65535,65535,65535,65535,65535},
+    {3011,3017,3021,3023,65535,65535,65535,65535,65535,65535},
+    {3012,3018,3022,65535,65535,65535,65535,65535,65535,65535},
+    {3013,3019,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3014,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3015,3024,3025,3026,3027,65535,65535,65535,65535,65535},
+    {3016,3025,3028,3029,65535,65535,65535,65535,65535,65535},
+    {3017,3026,3029,65535,65535,65535,65535,65535,65535,65535},
+    {3018,3027,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3019,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3020,3028,3030,65535,65535,65535,65535,65535,65535,65535},
+    {3021,3029,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3022,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3023,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3024,3031,3032,3033,65535,65535,65535,65535,65535,65535},
+    {3025,3032,3034,65535,65535,65535,65535,65535,65535,65535},
+    {3026,3033,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3027,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3028,3034,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3029,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3030,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3031,3035,3036,65535,65535,65535,65535,65535,65535,65535},
+    {3032,3036,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3033,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3034,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3035,3037,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3036,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3037,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3038,3039,3040,3041,3042,3043,65535,65535,65535,65535},
+    {3039,3044,3045,3046,3047,65535,65535,65535,65535,65535},
+    {3040,3045,3048,3049,65535,65535,65535,65535,65535,65535},
+    {3041,3046,3049,65535,65535,65535,65535,65535,65535,65535},
+    {3042,3047,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3043,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3044,3050,3051,3052,65535,65535,65535,65535,65535,65535},
+    {3045,3051,3053,65535,65535,65535,65535,65535,65535,65535},
+    {3046,3052,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3047,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3048,3053,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3049,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3050,3054,3055,65535,65535,65535,65535,65535,65535,65535},
+    {3051,3055,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3052,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3053,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3054,3056,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3055,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3056,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3057,3058,3059,3060,3061,65535,65535,65535,65535,65535},
+    {3058,3062,3063,3064,65535,65535,65535,65535,65535,65535},
+    {3059,3063,3065,65535,65535,65535,65535,65535,65535,65535},
+    {3060,3064,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3061,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3062,3066,3067,65535,65535,65535,65535,65535,65535,65535},
+    {3063,3067,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3064,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3065,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3066,3068,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3067,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3068,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3069,3070,3071,3072,65535,65535,65535,65535,65535,65535},
+    {3070,3073,3074,65535,65535,65535,65535,65535,65535,65535},
+    {3071,3074,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3072,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3073,3075,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3074,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3075,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3076,3077,3078,65535,65535,65535,65535,65535,65535,65535},
+    {3077,3079,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3078,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3079,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3080,3081,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3081,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {3082,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+    {65535,65535,65535,65535,65535,65535,65535,65535,65535,65535},
+};
+
+// by up card weight - 1: best decision in the low nibble, best decision without a split in the high one
+const uint8_t decisions[nodes_count][10] = {
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02,0x02},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x33,0x33,0x33,0x33,0x00,0x00,0x00,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x02,0x02,0x02,0x02,0x02,0x02,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x33,0x33,0x33,0x33,0x00,0x00,0x00,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x02,0x02,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x33,0x33,0x33,0x33,0x00,0x00,0x00,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x33,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x02,0x02,0x12,0x12,0x12,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x12,0x12,0x12,0x12,0x12,0x02,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x12,0x12,0x12,0x12,0x12,0x02,0x02,0x02,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x12,0x12,0x12,0x12,0x12,0x11,0x12,0x12,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x00,0x00},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x00,0x00,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x00},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x00,0x11,0x11,0x11,0x11,0x11,0x00,0x00,0x00,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+    {0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11,0x11},
+};
+
+}} // ns blackjack::strategy
@@ -0,0 +1,148 @@
+// Streams a trace dump through the decoder and prints its typed records, one per line:
+//
+//   deal <ses_id> up <card> box <n> <cards>...
+//   card <ses_id> box <n> hand <n> <hit|stand|split|double> <card>
+//   final <ses_id> deposit <amount> payout <amount> dealer <cards> box <n> <cards> [ split <cards> ]...
+//
+// A doubled hand's cards are followed by "x2". The first sessions whose events don't add up are reported to stderr.
+//
+// Usage: trace_decode [ --records <deal,card,final> ] [ --max-open <n> ] [ <dump file> | - ]
+// The dump is read from stdin by default; --records "" only reports the totals.
+
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+
+#include "decoder.hpp"
+
+using namespace blackjack::trace;
+
+namespace {
+
+const char* decision_names[] = {"hit", "stand", "split", "double"};
+
+void print_cards(std::ostream& os, const cards_t& cards) {
+    for (const auto& c : cards) {
+        os << ' ' << c.to_string();
+    }
+}
+
+class printer {
+public:
+    bool deals = true, cards = true, finals = true;
+
+    void on_deal(const session& s) {
+        if (!deals) {
+            return;
+        }
+        std::cout << "deal " << s.ses_id << " up " << s.dealer_cards[0].to_string();
+        for (size_t i = 0; i < s.boxes.size(); i++) {
+            std::cout << " box " << i;
+            print_cards(std::cout, s.boxes[i].hands[0]);
+        }
+        std::cout << '\n';
+    }
+
+    void on_card(const session& s, uint8_t box, uint8_t hand, uint16_t decision, card c) {
+        if (cards) {
+            std::cout << "card " << s.ses_id << " box " << int(box) << " hand " << int(hand) << ' '
+                      << decision_names[decision] << ' ' << c.to_string() << '\n';
+        }
+    }
+
+    void on_finish(const session& s, int64_t payout) {
+        if (!finals) {
+            return;
+        }
+        std::cout << "final " << s.ses_id << " deposit " << s.deposit << " payout " << payout << " dealer";
+        print_cards(std::cout, s.dealer_cards);
+        for (size_t i = 0; i < s.boxes.size(); i++) {
+            const auto& b = s.boxes[i];
+            std::cout << " box " << i;
+            print_cards(std::cout, b.hands[0]);
+            std::cout << (b.doubled[0] ? " x2" : "");
+            if (b.has_split()) {
+                std::cout << " split";
+                print_cards(std::cout, b.hands[1]);
+                std::cout << (b.doubled[1] ? " x2" : "");
+            }
+        }
+        std::cout << '\n';
+    }
+
+    // the first ones, a dump starting in the middle of games has an error for every event of them
+    void on_error(uint64_t ses_id, const char* what) {
+        if (errors++ < 10) {
+            std::cerr << "session " << ses_id << ": " << what << '\n';
+        }
+    }
+
+private:
+    uint64_t errors = 0;
+};
+
+} // anonymous ns
+
+int main(int argc, char** argv) {
+    std::ios::sync_with_stdio(false);
+    printer p;
+    size_t max_open = 100'000;
+    std::string path = "-";
+    try {
+        for (int i = 1; i < argc; i++) {
+            const std::string arg = argv[i];
+            if (arg == "--records" && i + 1 < argc) {
+                const std::string records = argv[++i];
+                p.deals = records.find("deal") != std::string::npos;
+                p.cards = records.find("card") != std::string::npos;
+                p.finals = records.find("final") != std::string::npos;
+            } else if (arg == "--max-open" && i + 1 < argc) {
+                max_open = std::max(1ll, std::atoll(argv[++i]));
+            } else if (arg.rfind("--", 0) == 0) {
+                throw std::invalid_argument("unknown option: " + arg);
+            } else {
+                path = arg;
+            }
+        }
+        const int fd = path == "-" ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("can't open " + path);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        decoder<printer> d(p, max_open);
+        line_reader lines(fd);
+        event e;
+        uint64_t line = 0, malformed = 0;
+        const char *begin, *end;
+        while (lines.next(begin, end)) {
+            line++;
+            if (begin == end) {
+                continue;
+            }
+            try {
+                parse(begin, end, e);
+            } catch (const std::invalid_argument& err) {
+                if (malformed++ < 10) {
+                    std::cerr << "line " << line << ": " << err.what() << '\n';
+                }
+                continue;
+            }
+            d.push(e);
+        }
+        std::cout.flush();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        const auto& s = d.get_stats();
+        std::cerr << s.events << " events in " << elapsed.count() << "s (" << uint64_t(s.events / elapsed.count())
+                  << " events/s), " << s.deals << " deals, " << s.cards << " cards, " << s.finished << " finished, "
+                  << d.open_sessions() << " open, " << s.errors << " errors, " << s.evicted << " evicted, peak "
+                  << s.peak_open << " open, " << malformed << " malformed lines" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "error: " << e.what() << std::endl;
+        std::cerr << "Usage: trace_decode [ --records <deal,card,final> ] [ --max-open <n> ] [ <dump file> | - ]" << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
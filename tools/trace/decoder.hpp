@@ -0,0 +1,327 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// card.hpp takes eosio::check from the including code
+#include <eosio/eosio.hpp>
+#include <blackjack/card.hpp>
+#include <blackjack/message.hpp>
+
+#include "event.hpp"
+
+// Rebuilds the hands of every session from its events. A message only carries the cards its
+// transaction dealt, so the decoder follows the player's decisions and moves between hands and
+// boxes the way the contract does: a stand, a double, a bust or 21 end a hand, a split plays
+// the first hand, then the second one, and split aces get a card each.
+//
+// Records go to a sink with the methods
+//   on_deal(const session&)                                       - the initial cards
+//   on_card(const session&, box, hand, decision, card)           - a card dealt for a decision
+//   on_finish(const session&, payout)                             - final cards of a finished game
+//   on_error(ses_id, const char* what)                            - the session's events don't add up,
+//                                                                   it's dropped
+// Memory is bounded by max_open: the least recently active session is dropped beyond it.
+namespace blackjack { namespace trace {
+
+using card_game::card;
+using card_game::cards_t;
+
+// the contract's action types and decisions, see blackjack.hpp
+const uint16_t bet_action = 0;
+const uint16_t play_action = 1;
+namespace decision {
+    const uint16_t hit = 0;
+    const uint16_t stand = 1;
+    const uint16_t split = 2;
+    const uint16_t double_down = 3;
+}
+
+struct box {
+    int64_t ante = 0;
+    int64_t pair = 0;
+    int64_t first_three = 0;
+    // the second hand is the split one
+    cards_t hands[2];
+    bool doubled[2] = {false, false};
+
+    bool has_split() const {
+        return !hands[1].empty();
+    }
+
+    bool has_blackjack() const {
+        return !has_split() && hands[0].size() == 2 && card_game::get_weight(hands[0]) == 21;
+    }
+};
+
+struct session {
+    uint64_t ses_id = 0;
+    // all the player deposited, with doubles and splits
+    int64_t deposit = 0;
+    std::vector<box> boxes;
+    cards_t dealer_cards;
+    bool dealt = false;
+    uint8_t active_box = 0;
+    uint8_t active_hand = 0;
+    // the decision waiting for its random
+    std::optional<uint16_t> pending;
+};
+
+struct decoder_stats {
+    uint64_t events = 0;
+    uint64_t deals = 0;
+    uint64_t cards = 0;
+    uint64_t finished = 0;
+    uint64_t errors = 0;
+    uint64_t evicted = 0;
+    uint64_t peak_open = 0;
+};
+
+template <typename Sink>
+class decoder {
+public:
+    decoder(Sink& sink, size_t max_open): sink(sink), max_open(max_open) {
+        index.reserve(max_open + 1);
+    }
+
+    void push(const event& e) {
+        stats.events++;
+        switch (e.kind) {
+        case event_kind::new_game:
+            drop(e.ses_id);
+            open(e.ses_id).deposit = e.deposit;
+            break;
+        case event_kind::action:
+            on_action(e);
+            break;
+        case event_kind::message:
+        case event_kind::finished:
+            on_message(e);
+            break;
+        }
+    }
+
+    const decoder_stats& get_stats() const {
+        return stats;
+    }
+
+    size_t open_sessions() const {
+        return index.size();
+    }
+
+private:
+    using lru_t = std::list<session>;
+
+    Sink& sink;
+    const size_t max_open;
+    // the most recently active session first
+    lru_t sessions;
+    std::unordered_map<uint64_t, lru_t::iterator> index;
+    decoder_stats stats;
+
+    session* find(uint64_t ses_id) {
+        const auto it = index.find(ses_id);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        sessions.splice(sessions.begin(), sessions, it->second);
+        return &*it->second;
+    }
+
+    session& open(uint64_t ses_id) {
+        sessions.emplace_front();
+        sessions.front().ses_id = ses_id;
+        index[ses_id] = sessions.begin();
+        if (index.size() > max_open) {
+            stats.evicted++;
+            fail(sessions.back(), "evicted");
+        }
+        stats.peak_open = std::max<uint64_t>(stats.peak_open, index.size());
+        return sessions.front();
+    }
+
+    void drop(uint64_t ses_id) {
+        const auto it = index.find(ses_id);
+        if (it != index.end()) {
+            sessions.erase(it->second);
+            index.erase(it);
+        }
+    }
+
+    void fail(const session& s, const char* what) {
+        stats.errors++;
+        const auto ses_id = s.ses_id;
+        sink.on_error(ses_id, what);
+        drop(ses_id);
+    }
+
+    void on_action(const event& e) {
+        session* s = find(e.ses_id);
+        if (e.type == bet_action) {
+            if (!s) {
+                // the dump starts after the game's been created
+                s = &open(e.ses_id);
+            }
+            if (s->dealt || !s->boxes.empty() || e.params.empty() || e.params.size() % 3) {
+                return fail(*s, "invalid bet");
+            }
+            int64_t bet_sum = 0;
+            for (size_t i = 0; i < e.params.size(); i += 3) {
+                box b;
+                b.ante = e.params[i];
+                b.pair = e.params[i + 1];
+                b.first_three = e.params[i + 2];
+                s->boxes.push_back(b);
+                bet_sum += b.ante + b.pair + b.first_three;
+            }
+            if (!s->deposit) {
+                s->deposit = bet_sum;
+            }
+            s->deposit += e.deposit;
+            return;
+        }
+        if (!s) {
+            stats.errors++;
+            return sink.on_error(e.ses_id, "action of an unknown session");
+        }
+        if (e.type != play_action || e.params.size() != 1 || e.params[0] > decision::double_down || !s->dealt || s->pending) {
+            return fail(*s, "unexpected action");
+        }
+        s->deposit += e.deposit;
+        const uint16_t d = e.params[0];
+        auto& b = s->boxes[s->active_box];
+        if (d == decision::split) {
+            if (b.has_split() || b.hands[0].size() != 2) {
+                return fail(*s, "invalid split");
+            }
+            b.hands[1].push_back(b.hands[0].back());
+            b.hands[0].pop_back();
+        } else if (d == decision::double_down) {
+            b.doubled[s->active_hand] = true;
+        } else if (d == decision::stand && next_hand(*s)) {
+            // no random, the player plays the next hand
+            return;
+        }
+        s->pending = d;
+    }
+
+    void on_message(const event& e) {
+        session* s = find(e.ses_id);
+        const bool finished = e.kind == event_kind::finished;
+        if (!s) {
+            stats.errors++;
+            return sink.on_error(e.ses_id, finished ? "finish of an unknown session" : "message of an unknown session");
+        }
+        auto reader = message::reader::from_serialized(e.msg.data(), e.msg.size());
+        if (!reader.valid()) {
+            return fail(*s, "invalid message");
+        }
+        auto [player_cards, dealer_cards] = reader.decode();
+        if (!s->dealt) {
+            // a blackjack in every box finishes the game on the deal, with the hole card
+            if (s->boxes.empty() || player_cards.size() != 2 * s->boxes.size()
+                || dealer_cards.size() != (finished ? 2 : 1)) {
+                return fail(*s, "invalid deal");
+            }
+            for (size_t i = 0; i < s->boxes.size(); i++) {
+                s->boxes[i].hands[0] = {player_cards[2 * i], player_cards[2 * i + 1]};
+            }
+            s->dealer_cards = std::move(dealer_cards);
+            s->dealt = true;
+            while (s->active_box < s->boxes.size() && s->boxes[s->active_box].has_blackjack()) {
+                s->active_box++;
+            }
+            stats.deals++;
+            sink.on_deal(*s);
+        } else {
+            if (!s->pending || !deal(*s, player_cards)) {
+                return fail(*s, "cards don't match the decision");
+            }
+            s->pending.reset();
+            if (finished) {
+                // but for the hole card of a deal, the up card isn't sent again
+                s->dealer_cards.insert(s->dealer_cards.end(), dealer_cards.begin(), dealer_cards.end());
+            } else if (!dealer_cards.empty()) {
+                return fail(*s, "dealer's cards before the finish");
+            }
+        }
+        if (finished) {
+            stats.finished++;
+            sink.on_finish(*s, e.payout);
+            drop(s->ses_id);
+        }
+    }
+
+    // cards dealt for the pending decision, false if they can't be
+    bool deal(session& s, const cards_t& cards) {
+        const auto d = *s.pending;
+        const uint8_t box_index = s.active_box;
+        auto& b = s.boxes[box_index];
+        const auto add = [&](uint8_t hand, card c) {
+            b.hands[hand].push_back(c);
+            stats.cards++;
+            sink.on_card(s, box_index, hand, d, c);
+        };
+        switch (d) {
+        case decision::hit:
+        case decision::double_down: {
+            if (cards.size() != 1) {
+                return false;
+            }
+            add(s.active_hand, cards[0]);
+            const auto w = card_game::get_weight(b.hands[s.active_hand]);
+            if (d == decision::double_down || w >= 21) {
+                next_hand(s);
+            }
+            return true;
+        }
+        case decision::split: {
+            if (cards.size() != 2) {
+                return false;
+            }
+            const bool aces = b.hands[0][0].get_rank() == card_game::rank::ACE;
+            add(0, cards[0]);
+            add(1, cards[1]);
+            // split aces get a card each, a 21 finishes a hand
+            bool box_finished = aces;
+            if (!aces && card_game::get_weight(b.hands[0]) == 21) {
+                s.active_hand = 1;
+                box_finished = card_game::get_weight(b.hands[1]) == 21;
+            }
+            if (box_finished) {
+                next_box(s);
+            }
+            return true;
+        }
+        default:
+            return cards.empty();
+        }
+    }
+
+    // false if it was the last hand
+    static bool next_hand(session& s) {
+        if (s.boxes[s.active_box].has_split() && s.active_hand == 0) {
+            s.active_hand = 1;
+            return true;
+        }
+        return next_box(s);
+    }
+
+    static bool next_box(session& s) {
+        size_t next = s.active_box + 1;
+        while (next < s.boxes.size() && s.boxes[next].has_blackjack()) {
+            next++;
+        }
+        if (next == s.boxes.size()) {
+            return false;
+        }
+        s.active_box = next;
+        s.active_hand = 0;
+        return true;
+    }
+};
+
+}} // ns blackjack::trace
@@ -0,0 +1,325 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// Game events of a trace dump, one JSON object per line:
+//
+//   {"ses_id":7,"event":"new_game","deposit":10000}
+//   {"ses_id":7,"event":"action","type":1,"params":[0],"deposit":0}
+//   {"ses_id":7,"event":"game_message","msg":"0301..."}
+//   {"ses_id":7,"event":"game_finished","payout":20000,"msg":"0301..."}
+//
+// Actions are the player's game actions, game_message and game_finished the platform's events, with
+// msg the hex of the serialized std::vector<param_t>, as the tests read it from event["msg"].
+// Amounts are in the smallest units of the asset. Keys may come in any order and unknown keys are skipped,
+// so a node's traces flattened by e.g. jq feed the decoder as they are.
+namespace blackjack { namespace trace {
+
+enum class event_kind : uint8_t {
+    new_game,
+    action,
+    message,
+    finished,
+};
+
+struct event {
+    uint64_t ses_id = 0;
+    event_kind kind = event_kind::action;
+    uint16_t type = 0;
+    std::vector<uint64_t> params;
+    // deposit of a new game or transferred with an action
+    int64_t deposit = 0;
+    int64_t payout = 0;
+    std::vector<char> msg;
+};
+
+namespace detail {
+
+inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+// a cursor over a line, throws std::invalid_argument on anything that isn't expected
+class scanner {
+public:
+    scanner(const char* begin, const char* end): p(begin), end(end) {}
+
+    void skip_spaces() {
+        while (p < end && is_space(*p)) {
+            p++;
+        }
+    }
+
+    bool at_end() {
+        skip_spaces();
+        return p == end;
+    }
+
+    char peek() {
+        skip_spaces();
+        return p < end ? *p : 0;
+    }
+
+    void expect(char c) {
+        if (peek() != c) {
+            throw std::invalid_argument(std::string("expected ") + c);
+        }
+        p++;
+    }
+
+    // the characters of a string without escapes, which keys, event names and hex never have
+    std::pair<const char*, const char*> string() {
+        expect('"');
+        const char* begin = p;
+        while (p < end && *p != '"') {
+            if (*p == '\\') {
+                throw std::invalid_argument("escapes aren't supported");
+            }
+            p++;
+        }
+        if (p == end) {
+            throw std::invalid_argument("unterminated string");
+        }
+        return {begin, p++};
+    }
+
+    int64_t integer() {
+        skip_spaces();
+        const bool negative = p < end && *p == '-';
+        p += negative;
+        if (p == end || *p < '0' || *p > '9') {
+            throw std::invalid_argument("expected a number");
+        }
+        uint64_t v = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            v = v * 10 + (*p++ - '0');
+        }
+        return negative ? -int64_t(v) : int64_t(v);
+    }
+
+    // any value of a key the decoder doesn't need
+    void skip_value() {
+        const char c = peek();
+        if (c == '"') {
+            string();
+            return;
+        }
+        if (c != '{' && c != '[') {
+            while (p < end && *p != ',' && *p != '}' && *p != ']' && !is_space(*p)) {
+                p++;
+            }
+            return;
+        }
+        int depth = 0;
+        do {
+            if (*p == '"') {
+                string();
+                continue;
+            }
+            depth += (*p == '{' || *p == '[') - (*p == '}' || *p == ']');
+            p++;
+        } while (p < end && depth > 0);
+        if (depth) {
+            throw std::invalid_argument("unterminated value");
+        }
+    }
+
+private:
+    const char* p;
+    const char* end;
+};
+
+inline bool equals(std::pair<const char*, const char*> s, const char* literal) {
+    const size_t n = std::strlen(literal);
+    return size_t(s.second - s.first) == n && std::memcmp(s.first, literal, n) == 0;
+}
+
+inline int hex_digit(char c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    throw std::invalid_argument("invalid hex");
+}
+
+} // ns detail
+
+// parses a line into e, reusing its buffers. Throws std::invalid_argument on a malformed line
+inline void parse(const char* begin, const char* end, event& e) {
+    detail::scanner s(begin, end);
+    e.params.clear();
+    e.msg.clear();
+    e.type = 0;
+    e.deposit = 0;
+    e.payout = 0;
+    bool has_ses_id = false, has_kind = false;
+    s.expect('{');
+    if (s.peek() == '}') {
+        throw std::invalid_argument("empty event");
+    }
+    while (true) {
+        const auto key = s.string();
+        s.expect(':');
+        if (detail::equals(key, "ses_id")) {
+            e.ses_id = s.integer();
+            has_ses_id = true;
+        } else if (detail::equals(key, "event")) {
+            const auto name = s.string();
+            if (detail::equals(name, "action")) {
+                e.kind = event_kind::action;
+            } else if (detail::equals(name, "game_message")) {
+                e.kind = event_kind::message;
+            } else if (detail::equals(name, "game_finished")) {
+                e.kind = event_kind::finished;
+            } else if (detail::equals(name, "new_game")) {
+                e.kind = event_kind::new_game;
+            } else {
+                throw std::invalid_argument("unknown event " + std::string(name.first, name.second));
+            }
+            has_kind = true;
+        } else if (detail::equals(key, "type")) {
+            e.type = s.integer();
+        } else if (detail::equals(key, "params")) {
+            s.expect('[');
+            while (s.peek() != ']') {
+                e.params.push_back(s.integer());
+                if (s.peek() == ',') {
+                    s.expect(',');
+                }
+            }
+            s.expect(']');
+        } else if (detail::equals(key, "deposit")) {
+            e.deposit = s.integer();
+        } else if (detail::equals(key, "payout")) {
+            e.payout = s.integer();
+        } else if (detail::equals(key, "msg")) {
+            const auto hex = s.string();
+            if ((hex.second - hex.first) % 2) {
+                throw std::invalid_argument("odd hex length");
+            }
+            for (const char* h = hex.first; h < hex.second; h += 2) {
+                e.msg.push_back(char(detail::hex_digit(h[0]) << 4 | detail::hex_digit(h[1])));
+            }
+        } else {
+            s.skip_value();
+        }
+        if (s.peek() != ',') {
+            break;
+        }
+        s.expect(',');
+    }
+    s.expect('}');
+    if (!s.at_end()) {
+        throw std::invalid_argument("trailing characters");
+    }
+    if (!has_ses_id || !has_kind) {
+        throw std::invalid_argument("ses_id or event is missing");
+    }
+}
+
+// serialized std::vector<uint64_t> params: the varint count, then the words
+inline std::vector<char> serialize(const std::vector<uint64_t>& words) {
+    std::vector<char> bytes;
+    uint64_t n = words.size();
+    do {
+        bytes.push_back(char((n & 0x7f) | (n > 0x7f ? 0x80 : 0)));
+        n >>= 7;
+    } while (n);
+    for (const auto w : words) {
+        for (int i = 0; i < 8; i++) {
+            bytes.push_back(char(w >> (8 * i)));
+        }
+    }
+    return bytes;
+}
+
+inline void write(std::ostream& os, const event& e) {
+    static const char* names[] = {"new_game", "action", "game_message", "game_finished"};
+    static const char digits[] = "0123456789abcdef";
+    os << "{\"ses_id\":" << e.ses_id << ",\"event\":\"" << names[int(e.kind)] << '"';
+    switch (e.kind) {
+    case event_kind::new_game:
+        os << ",\"deposit\":" << e.deposit;
+        break;
+    case event_kind::action:
+        os << ",\"type\":" << e.type << ",\"params\":[";
+        for (size_t i = 0; i < e.params.size(); i++) {
+            os << (i ? "," : "") << e.params[i];
+        }
+        os << "],\"deposit\":" << e.deposit;
+        break;
+    case event_kind::finished:
+        os << ",\"payout\":" << e.payout;
+        // fallthrough
+    case event_kind::message:
+        os << ",\"msg\":\"";
+        for (const char c : e.msg) {
+            os << digits[uint8_t(c) >> 4] << digits[uint8_t(c) & 0xf];
+        }
+        os << '"';
+        break;
+    }
+    os << "}\n";
+}
+
+// reads a dump line by line through a fixed buffer, so memory doesn't grow with the dump.
+// Lines are returned as soon as they're read, a pipe from a live feed isn't waited on to fill the buffer
+class line_reader {
+public:
+    explicit line_reader(int fd, size_t buffer_size = 1 << 20): fd(fd), buffer(buffer_size) {}
+
+    // the next line without its newline, false at the end of the dump
+    bool next(const char*& begin, const char*& end) {
+        while (true) {
+            const auto newline = static_cast<char*>(std::memchr(buffer.data() + pos, '\n', filled - pos));
+            if (newline) {
+                begin = buffer.data() + pos;
+                end = newline;
+                pos = newline - buffer.data() + 1;
+                return true;
+            }
+            if (eof) {
+                if (pos == filled) {
+                    return false;
+                }
+                // the last line without a newline
+                begin = buffer.data() + pos;
+                end = buffer.data() + filled;
+                pos = filled;
+                return true;
+            }
+            std::memmove(buffer.data(), buffer.data() + pos, filled - pos);
+            filled -= pos;
+            pos = 0;
+            if (filled == buffer.size()) {
+                throw std::runtime_error("a line is longer than the read buffer");
+            }
+            const auto n = ::read(fd, buffer.data() + filled, buffer.size() - filled);
+            if (n < 0) {
+                throw std::runtime_error("can't read the dump");
+            }
+            filled += n;
+            eof = n == 0;
+        }
+    }
+
+private:
+    int fd;
+    std::vector<char> buffer;
+    size_t pos = 0;
+    size_t filled = 0;
+    bool eof = false;
+};
+
+}} // ns blackjack::trace